@@ -2,16 +2,91 @@
 
 #include "motor_controller.h"
 #include "command_router.h"
+#include "command_queue.h"
 #include "mqtt_handler.h"
 #include "http_server.h"
 #include "wifi_config.h"
+#include "metrics.h"
+#include "heap_monitor.h"
+#include "logger.h"
+#include "watchdog.h"
+#include "ota_updater.h"
 
 // Instantiate core components
 MotorController motorController;
 CommandRouter commandRouter(motorController);
+CommandQueue commandQueue;
 MQTTHandler mqttHandler(commandRouter);
 HTTPServer httpServer(commandRouter);
 
+// Drain buffer for queued commands (kept off the stack)
+static char queuedCommand[CommandQueue::MAX_COMMAND_LENGTH];
+
+// NEW: Dual-core task split
+// Core 0 runs the network task (MQTT servicing; WiFi/LwIP and the async
+// HTTP server already live there). Core 1 runs the motor task, so a slow
+// MQTT reconnect (tryConnection() can block 1-2s by design) can never
+// stretch an in-flight tap. The command queue is the mailbox between them.
+static TaskHandle_t motorTaskHandle = nullptr;
+static TaskHandle_t networkTaskHandle = nullptr;
+
+void motorTask(void* parameter) {
+  for (;;) {
+    Watchdog::beat(Watchdog::CP_MOTOR);  // Feeds the failsafe deadline too
+
+    // Emergency-lane cleanup first - the GPIOs were already de-energized
+    // by the transport handler that took the stop
+    motorController.serviceEmergencyStop();
+
+    // Drain queued commands from HTTP/MQTT handlers (parsed in place,
+    // no heap allocation from packet arrival to dispatch)
+    size_t commandLength = 0;
+    unsigned long enqueuedAtUs = 0;
+    while (commandQueue.dequeue(queuedCommand, commandLength, &enqueuedAtUs)) {
+      Metrics::markCommandReceived(enqueuedAtUs);
+      // The magic byte routes binary frames (MQTT /command/bin) past the
+      // JSON parser; everything else takes the JSON path
+      if (commandLength > 0 && (uint8_t)queuedCommand[0] == CommandRouter::BINARY_FRAME_MAGIC) {
+        commandRouter.handleBinaryCommand((const uint8_t*)queuedCommand, commandLength);
+      } else {
+        commandRouter.handleJsonCommand(queuedCommand, commandLength);
+      }
+      Metrics::recordDispatchDone();
+    }
+
+    commandRouter.dispatchScheduled();  // Fire due group-synchronized commands
+
+    motorController.updateTap();                 // Legacy tap sequences
+    motorController.updateTimedOperations();     // Time-based operations (relay mimicking)
+    motorController.updateDualCardOperations();  // Dual card operations
+    motorController.updateSequence();            // Batch tap sequences
+    motorController.updateBench();               // Benchmark cycles
+    motorController.updateIntervalSchedule();    // Endurance tap cadence
+
+    // Safety timeout checking (no position sensors)
+    motorController.checkLimitSwitches();
+
+    // Keep the crash report's operation field current for stall attribution
+    Watchdog::noteOperation(motorController.getOperationCString());
+
+    vTaskDelay(1 / portTICK_PERIOD_MS);  // 1ms motor update tick
+  }
+}
+
+void networkTask(void* parameter) {
+  for (;;) {
+    // MQTT no longer needs to yield to the motor - it runs on its own core
+    mqttHandler.loop();
+    httpServer.pollStatusEvents();  // SSE push when the status version moved
+    Watchdog::beat(Watchdog::CP_MQTT);
+    Watchdog::update();     // Motor-deadline failsafe check
+    Logger::drain();        // Flush buffered log lines off the hot path
+    HeapMonitor::update();  // 1Hz heap sampling + low-water event log
+    OtaUpdater::update();   // Pull downloads, rollback confirm, reboot gate
+    vTaskDelay(10 / portTICK_PERIOD_MS);
+  }
+}
+
 void setup() {
   // Serial for debugging
   Serial.begin(115200);
@@ -19,7 +94,10 @@ void setup() {
 
   Serial.println("[Tapper] Starting ESP32 Dual Card Relay-Mimicking Tapper...");
 
-  // Connect to WiFi
+  // Arm the task watchdog early and recover any pre-crash stall report
+  Watchdog::init();
+
+  // Kick off WiFi in the background - boot no longer waits on association
   WiFiConfig::connect();
 
   // Initialize hardware and modules
@@ -31,31 +109,25 @@ void setup() {
   // Set motor controller reference for detailed MQTT status reporting
   mqttHandler.setMotorController(&motorController);
 
+  // Motor state machine on core 1, above the Arduino loop task priority
+  xTaskCreatePinnedToCore(motorTask, "motor", 4096, nullptr, 3, &motorTaskHandle, 1);
+  // MQTT servicing on core 0, alongside WiFi/LwIP and the async HTTP server
+  xTaskCreatePinnedToCore(networkTask, "network", 8192, nullptr, 1, &networkTaskHandle, 0);
+
+  // Both pinned tasks answer to the task watchdog from here on
+  Watchdog::supervise(motorTaskHandle);
+  Watchdog::supervise(networkTaskHandle);
+
   Serial.println("[Tapper] ESP32 dual card tapper system ready.");
   Serial.println("[Tapper] Features:");
   Serial.println("  - Timing-based positioning (relay mimicking)");
   Serial.println("  - Dual card support via Python framework");
   Serial.println("  - HTTP and MQTT protocols");
   Serial.println("  - Time-based operations (extend_for_time, retract_for_time)");
+  Serial.println("  - Motor task pinned to core 1, networking on core 0");
 }
 
 void loop() {
-  // HIGHEST PRIORITY: Motor control updates
-  motorController.updateTap();           // Legacy tap sequences
-  motorController.updateTimedOperations(); // Time-based operations (relay mimicking)
-  motorController.updateDualCardOperations(); // NEW: Dual card operations
-
-  // Safety timeout checking (no position sensors)
-  motorController.checkLimitSwitches();
-
-  // HIGHEST PRIORITY: HTTP server (user commands)
-  httpServer.loop();
-
-  // LOWER PRIORITY: MQTT (only if motor not active)
-  if (!motorController.isTapping()) {
-    mqttHandler.loop();
-  }
-
-  // Minimal delay for ESP32 stability
-  delay(10);
+  // Everything runs in the pinned tasks now; keep the loop task quiet
+  vTaskDelay(1000 / portTICK_PERIOD_MS);
 }
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include "calibration.h"
+#include <Preferences.h>
+
+static const char* CALIBRATION_NAMESPACE = "tapper_cal";
+
+const CalibrationTable::Field CalibrationTable::FIELDS[] = {
+  { "c1_out_12v", &CalibrationTable::card1FromHome12vUs },
+  { "c1_pause_12v", &CalibrationTable::card1TapPause12vUs },
+  { "c1_home_12v", &CalibrationTable::card1ToHome12vUs },
+  { "c2_out_12v", &CalibrationTable::card2FromHome12vUs },
+  { "c2_pause_12v", &CalibrationTable::card2TapPause12vUs },
+  { "c2_home_12v", &CalibrationTable::card2ToHome12vUs },
+  { "home_ext_12v", &CalibrationTable::homeFromExtended12vUs },
+  { "home_ret_12v", &CalibrationTable::homeFromRetracted12vUs },
+  { "ext_full_12v", &CalibrationTable::extendFull12vUs },
+  { "ret_full_12v", &CalibrationTable::retractFull12vUs },
+  { "c1_out_usb", &CalibrationTable::card1FromHomeUsbUs },
+  { "c1_pause_usb", &CalibrationTable::card1TapPauseUsbUs },
+  { "c1_home_usb", &CalibrationTable::card1ToHomeUsbUs },
+  { "c2_out_usb", &CalibrationTable::card2FromHomeUsbUs },
+  { "c2_pause_usb", &CalibrationTable::card2TapPauseUsbUs },
+  { "c2_home_usb", &CalibrationTable::card2ToHomeUsbUs },
+  { "home_ext_usb", &CalibrationTable::homeFromExtendedUsbUs },
+  { "home_ret_usb", &CalibrationTable::homeFromRetractedUsbUs },
+  { "ext_full_usb", &CalibrationTable::extendFullUsbUs },
+  { "ret_full_usb", &CalibrationTable::retractFullUsbUs },
+};
+
+const size_t CalibrationTable::FIELD_COUNT = sizeof(FIELDS) / sizeof(FIELDS[0]);
+
+void CalibrationTable::load() {
+  Preferences prefs;
+  if (!prefs.begin(CALIBRATION_NAMESPACE, true)) {
+    // No namespace yet - first boot on this unit, defaults apply
+    Serial.println("[Calibration] No stored table - using measured defaults");
+    return;
+  }
+
+  size_t overrides = 0;
+  for (size_t i = 0; i < FIELD_COUNT; i++) {
+    if (prefs.isKey(FIELDS[i].key)) {
+      this->*(FIELDS[i].member) = prefs.getULong(FIELDS[i].key);
+      overrides++;
+    }
+  }
+  prefs.end();
+
+  Serial.println("[Calibration] Loaded " + String(overrides) + " NVS overrides");
+}
+
+bool CalibrationTable::set(const char* key, unsigned long valueUs) {
+  for (size_t i = 0; i < FIELD_COUNT; i++) {
+    if (strcmp(FIELDS[i].key, key) == 0) {
+      this->*(FIELDS[i].member) = valueUs;
+
+      Preferences prefs;
+      prefs.begin(CALIBRATION_NAMESPACE, false);
+      prefs.putULong(key, valueUs);
+      prefs.end();
+
+      Serial.println("[Calibration] " + String(key) + " = " + String(valueUs) + "us (persisted)");
+      return true;
+    }
+  }
+
+  Serial.println("[Calibration] Unknown key: " + String(key));
+  return false;
+}
+
+bool CalibrationTable::get(const char* key, unsigned long& valueUs) const {
+  for (size_t i = 0; i < FIELD_COUNT; i++) {
+    if (strcmp(FIELDS[i].key, key) == 0) {
+      valueUs = this->*(FIELDS[i].member);
+      return true;
+    }
+  }
+  return false;
+}
+
+void CalibrationTable::toJson(JsonDocument& doc) const {
+  for (size_t i = 0; i < FIELD_COUNT; i++) {
+    doc[FIELDS[i].key] = this->*(FIELDS[i].member);
+  }
+}
@@ -0,0 +1,54 @@
+// calibration.h - NVS-backed movement timing table
+// The measured movement times used to be compile-time constants in
+// motor_controller.h, so recalibrating a mechanically-worn unit meant
+// reflashing it. The table below keeps the same measured values as
+// defaults, loads per-device overrides from NVS flash once at init, and
+// persists individual updates from the /api/calibration JSON API.
+#ifndef CALIBRATION_H
+#define CALIBRATION_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+class CalibrationTable {
+public:
+  // 12V External Power (fast) - MEASURED VALUES in microseconds
+  unsigned long card1FromHome12vUs = 1000000;    // Card 1 tap: extend to card
+  unsigned long card1TapPause12vUs = 100000;     // Card 1 tap: pause at card
+  unsigned long card1ToHome12vUs = 995000;       // Card 1 tap: return to home (5ms drift compensation)
+  unsigned long card2FromHome12vUs = 1400000;    // Card 2 tap: retract to card
+  unsigned long card2TapPause12vUs = 100000;     // Card 2 tap: pause at card
+  unsigned long card2ToHome12vUs = 1395000;      // Card 2 tap: return to home (5ms drift compensation)
+  unsigned long homeFromExtended12vUs = 1306000; // MEASURED: middle from extended
+  unsigned long homeFromRetracted12vUs = 1284000; // MEASURED: middle from retracted
+  unsigned long extendFull12vUs = 2568000;       // MEASURED: full extend travel time
+  unsigned long retractFull12vUs = 2611000;      // MEASURED: full retract travel time
+
+  // USB Power (slow) - Calculated from 12V measurements with 2.3x multiplier
+  unsigned long card1FromHomeUsbUs = 2530000;
+  unsigned long card1TapPauseUsbUs = 1000000;
+  unsigned long card1ToHomeUsbUs = 2530000;
+  unsigned long card2FromHomeUsbUs = 2990000;
+  unsigned long card2TapPauseUsbUs = 1000000;
+  unsigned long card2ToHomeUsbUs = 2990000;
+  unsigned long homeFromExtendedUsbUs = 3004000;
+  unsigned long homeFromRetractedUsbUs = 2953000;
+  unsigned long extendFullUsbUs = 5906000;
+  unsigned long retractFullUsbUs = 6005000;
+
+  void load();  // Apply NVS overrides on top of the defaults (call once at init)
+  bool set(const char* key, unsigned long valueUs);         // Update + persist to NVS
+  bool get(const char* key, unsigned long& valueUs) const;  // Lookup by key
+  void toJson(JsonDocument& doc) const;                     // All entries, keyed
+
+private:
+  // Key strings double as NVS keys (NVS caps keys at 15 characters)
+  struct Field {
+    const char* key;
+    unsigned long CalibrationTable::* member;
+  };
+  static const Field FIELDS[];
+  static const size_t FIELD_COUNT;
+};
+
+#endif
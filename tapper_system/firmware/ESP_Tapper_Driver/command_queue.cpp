@@ -0,0 +1,52 @@
+#include "command_queue.h"
+#include "logger.h"
+
+bool CommandQueue::enqueue(const char* data, size_t length) {
+  if (length >= MAX_COMMAND_LENGTH) {
+    dropped = dropped + 1;
+    LOG_WARN("Queue", "Command too long - dropped");
+    return false;
+  }
+
+  taskENTER_CRITICAL(&producerMux);
+  size_t currentTail = tail;
+  size_t nextTail = (currentTail + 1) & (QUEUE_CAPACITY - 1);
+  if (nextTail == head) {
+    dropped = dropped + 1;
+    taskEXIT_CRITICAL(&producerMux);
+    LOG_WARN("Queue", "Queue full - command dropped");
+    return false;
+  }
+
+  memcpy(entries[currentTail].data, data, length);
+  entries[currentTail].data[length] = '\0';
+  entries[currentTail].length = length;
+  entries[currentTail].enqueuedAtUs = micros();
+  tail = nextTail;  // Publish the slot only after the copy is complete
+  taskEXIT_CRITICAL(&producerMux);
+  return true;
+}
+
+bool CommandQueue::dequeue(char* out, size_t& length, unsigned long* enqueuedAtUs) {
+  size_t currentHead = head;
+  if (currentHead == tail) {
+    return false;  // Empty
+  }
+
+  length = entries[currentHead].length;
+  memcpy(out, entries[currentHead].data, length);
+  out[length] = '\0';
+  if (enqueuedAtUs) {
+    *enqueuedAtUs = entries[currentHead].enqueuedAtUs;
+  }
+  head = (currentHead + 1) & (QUEUE_CAPACITY - 1);
+  return true;
+}
+
+bool CommandQueue::isEmpty() const {
+  return head == tail;
+}
+
+bool CommandQueue::isFull() const {
+  return ((tail + 1) & (QUEUE_CAPACITY - 1)) == head;
+}
@@ -0,0 +1,52 @@
+// command_queue.h - Fixed-capacity lock-free command queue
+// Decouples the network handlers (HTTP/MQTT) from command dispatch so
+// transport callbacks can return immediately instead of waiting on JSON
+// parsing, routing, and MQTT status publishes.
+#ifndef COMMAND_QUEUE_H
+#define COMMAND_QUEUE_H
+
+#include <Arduino.h>
+
+class CommandQueue {
+public:
+  static const size_t QUEUE_CAPACITY = 8;  // Must be a power of two
+  // Matches the router's 1KB parse document, so a full run_sequence step
+  // array survives the queue (8KB of static slots total)
+  static const size_t MAX_COMMAND_LENGTH = 1024;
+
+  // Producer side (HTTP handler / MQTT callback). Copies the command bytes
+  // into a pre-allocated slot - no heap allocation. Returns false if the
+  // queue is full or the command is too long (command is dropped, counted).
+  bool enqueue(const char* data, size_t length);
+
+  // Consumer side (main loop). Copies the oldest command into 'out'
+  // (must hold MAX_COMMAND_LENGTH bytes) and null-terminates it.
+  // 'enqueuedAtUs' (optional) receives the micros() receive timestamp
+  // so the consumer can record queue-wait latency.
+  // Returns false if the queue is empty.
+  bool dequeue(char* out, size_t& length, unsigned long* enqueuedAtUs = nullptr);
+
+  bool isEmpty() const;
+  bool isFull() const;
+  size_t droppedCount() const { return dropped; }
+
+private:
+  struct Entry {
+    char data[MAX_COMMAND_LENGTH];
+    size_t length;
+    unsigned long enqueuedAtUs;  // Receive timestamp for latency metrics
+  };
+
+  Entry entries[QUEUE_CAPACITY];
+
+  // Ring buffer: only producers write 'tail', only the consumer (motor
+  // task) writes 'head'. There are now two producers (async HTTP task and
+  // the network task's MQTT callback), so the producer side serializes slot
+  // reservation with a spinlock; the consumer never takes it.
+  portMUX_TYPE producerMux = portMUX_INITIALIZER_UNLOCKED;
+  volatile size_t head = 0;  // Next slot to dequeue
+  volatile size_t tail = 0;  // Next slot to enqueue
+  volatile size_t dropped = 0;
+};
+
+#endif
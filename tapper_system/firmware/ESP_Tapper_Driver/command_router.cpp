@@ -1,7 +1,68 @@
 #include "command_router.h"
 #include "motor_controller.h"
+#include "wifi_config.h"
+#include "ota_updater.h"
+#include "logger.h"
 #include <ArduinoJson.h>
 
+extern uint8_t assignedStationId;  // Station assignment (http_server.cpp)
+
+// ============ NEW: COMPILE-TIME COMMAND TOKEN TABLE ============
+// Command dispatch used to be a 15-way chain of String comparisons, with
+// heap-allocated String temporaries on every call. The table below is built
+// entirely at compile time: each entry carries an FNV-1a hash of its token,
+// so dispatch is one hash of the incoming bytes plus (at most) one strcmp
+// to guard against collisions - no heap allocation anywhere on the path.
+
+namespace {
+
+typedef void (MotorController::*CommandHandler)();
+
+constexpr uint32_t fnv1aHash(const char* s, uint32_t hash = 2166136261u) {
+  return *s == '\0' ? hash : fnv1aHash(s + 1, (hash ^ (uint32_t)(uint8_t)*s) * 16777619u);
+}
+
+uint32_t fnv1aHashRuntime(const char* s) {
+  uint32_t hash = 2166136261u;
+  while (*s != '\0') {
+    hash = (hash ^ (uint32_t)(uint8_t)*s) * 16777619u;
+    s++;
+  }
+  return hash;
+}
+
+struct CommandEntry {
+  const char* token;
+  uint32_t hash;
+  CommandHandler handler;
+};
+
+#define COMMAND_ENTRY(token, method) { token, fnv1aHash(token), &MotorController::method }
+
+constexpr CommandEntry COMMAND_TABLE[] = {
+  // Basic motor commands
+  COMMAND_ENTRY("extend", extend),
+  COMMAND_ENTRY("retract", retract),
+  COMMAND_ENTRY("stop", stop),
+  COMMAND_ENTRY("tap", startTap),
+  // Dual card commands
+  COMMAND_ENTRY("reset_to_middle", resetToMiddle),
+  COMMAND_ENTRY("tap_card1", tapCard1),
+  COMMAND_ENTRY("tap_card2", tapCard2),
+  // Calibration commands
+  COMMAND_ENTRY("manual_extend", manualExtend),
+  COMMAND_ENTRY("manual_retract", manualRetract),
+  COMMAND_ENTRY("manual_stop", manualStop),
+  COMMAND_ENTRY("capture_middle", captureCurrentAsMiddle),
+  // Power source commands
+  COMMAND_ENTRY("power_12v", setPowerSource12V),
+  COMMAND_ENTRY("power_usb", setPowerSourceUSB),
+};
+
+const size_t COMMAND_TABLE_SIZE = sizeof(COMMAND_TABLE) / sizeof(COMMAND_TABLE[0]);
+
+}  // namespace
+
 CommandRouter::CommandRouter(MotorController& motor)
   : motorController(motor) {}
 
@@ -9,87 +70,312 @@ void CommandRouter::init() {
   Serial.println("[Router] Relay-mimicking command router initialized");
 }
 
-void CommandRouter::handleCommand(const String& command) {
-  Serial.println("[Router] Handling command: " + command);
+uint8_t CommandRouter::crc8(const uint8_t* data, size_t length) {
+  // CRC-8/MAXIM (reflected 0x31), the common 1-Wire variant
+  uint8_t crc = 0;
+  for (size_t i = 0; i < length; i++) {
+    uint8_t byte = data[i];
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      uint8_t mix = (crc ^ byte) & 0x01;
+      crc >>= 1;
+      if (mix) crc ^= 0x8C;
+      byte >>= 1;
+    }
+  }
+  return crc;
+}
 
-  // Basic motor commands
-  if (command == "extend") {
-    motorController.extend();
-  } else if (command == "retract") {
-    motorController.retract();
-  } else if (command == "stop") {
-    motorController.stop();
-  } else if (command == "tap") {
-    motorController.startTap();
-  } 
-  // NEW: Dual card commands
-  else if (command == "reset_to_middle") {
-    motorController.resetToMiddle();
-  } else if (command == "tap_card1") {
-    motorController.tapCard1();
-  } else if (command == "tap_card2") {
-    motorController.tapCard2();
-  }
-  // NEW: Calibration commands
-  else if (command == "manual_extend") {
-    motorController.manualExtend();
-  } else if (command == "manual_retract") {
-    motorController.manualRetract();
-  } else if (command == "manual_stop") {
-    motorController.manualStop();
-  } else if (command == "capture_middle") {
-    motorController.captureCurrentAsMiddle();
-  }
-  // NEW: Power source commands
-  else if (command == "power_12v") {
-    motorController.setPowerSource12V();
-  } else if (command == "power_usb") {
-    motorController.setPowerSourceUSB();
-  } else {
-    Serial.println("[Router] Unknown command: " + command);
+void CommandRouter::handleBinaryCommand(const uint8_t* data, size_t length) {
+  if (length != sizeof(BinaryCommandFrame)) {
+    LOG_WARN("Router", "Binary frame size mismatch - dropped");
+    return;
+  }
+
+  BinaryCommandFrame frame;
+  memcpy(&frame, data, sizeof(frame));  // Alignment-safe "cast"
+
+  if (frame.magic != BINARY_FRAME_MAGIC) {
+    LOG_WARN("Router", "Binary frame bad magic - dropped");
+    return;
+  }
+  if (crc8(data, sizeof(frame) - 1) != frame.crc) {
+    LOG_WARN("Router", "Binary frame CRC mismatch - dropped");
+    return;
+  }
+  if (haveBinarySequence && frame.sequence == lastBinarySequence) {
+    LOG_WARN("Router", "Binary frame duplicate sequence - dropped");
+    return;
+  }
+  lastBinarySequence = frame.sequence;
+  haveBinarySequence = true;
+
+  // Same OTA gate as the JSON paths - while an image is being flashed
+  // only a stop acts on the device
+  if (OtaUpdater::isActive() && frame.opcode != BIN_OP_STOP) {
+    LOG_WARN("Router", "Binary opcode %u dropped - OTA update in progress", frame.opcode);
+    return;
+  }
+
+  switch (frame.opcode) {
+    case BIN_OP_STOP:             motorController.stop(); break;
+    case BIN_OP_EXTEND:           motorController.extend(); break;
+    case BIN_OP_RETRACT:          motorController.retract(); break;
+    case BIN_OP_TAP:              motorController.startTap(); break;
+    case BIN_OP_RESET_TO_MIDDLE:  motorController.resetToMiddle(); break;
+    case BIN_OP_TAP_CARD1:        motorController.tapCard1(); break;
+    case BIN_OP_TAP_CARD2:        motorController.tapCard2(); break;
+    case BIN_OP_EXTEND_FOR_TIME:  motorController.extendForTime(frame.durationMs); break;
+    case BIN_OP_RETRACT_FOR_TIME: motorController.retractForTime(frame.durationMs); break;
+    default:
+      LOG_WARN("Router", "Unknown binary opcode: %u", frame.opcode);
+      break;
   }
 }
 
+bool CommandRouter::scheduleCommand(const char* action, unsigned long durationMs, uint64_t executeAtEpochMs) {
+  if (strcmp(action, "run_sequence") == 0) {
+    LOG_WARN("Router", "run_sequence cannot be scheduled - executing now");
+    return false;
+  }
+  if (!WiFiConfig::isTimeSynced()) {
+    LOG_WARN("Router", "Clock not synced - executing scheduled command now");
+    return false;
+  }
+
+  uint64_t now = WiFiConfig::epochMillis();
+  if (executeAtEpochMs <= now) {
+    LOG_WARN("Router", "execute_at already passed - executing now");
+    return false;
+  }
+  uint64_t deltaMs = executeAtEpochMs - now;
+  if (deltaMs > 60000ULL) {
+    // A minute out is almost certainly a unit mix-up (seconds vs ms)
+    LOG_WARN("Router", "execute_at too far out (%lums) - executing now", (unsigned long)deltaMs);
+    return false;
+  }
+
+  for (size_t i = 0; i < MAX_SCHEDULED_COMMANDS; i++) {
+    if (scheduled[i].active) continue;
+    strncpy(scheduled[i].action, action, sizeof(scheduled[i].action) - 1);
+    scheduled[i].action[sizeof(scheduled[i].action) - 1] = '\0';
+    scheduled[i].durationMs = durationMs;
+    scheduled[i].fireAtMs = millis() + (unsigned long)deltaMs;
+    scheduled[i].active = true;
+    LOG_INFO("Router", "Scheduled '%s' in %lums", action, (unsigned long)deltaMs);
+    return true;
+  }
+
+  LOG_WARN("Router", "Schedule table full - executing now");
+  return false;
+}
+
+void CommandRouter::dispatchScheduled() {
+  for (size_t i = 0; i < MAX_SCHEDULED_COMMANDS; i++) {
+    if (!scheduled[i].active) continue;
+    if ((long)(millis() - scheduled[i].fireAtMs) < 0) continue;
+    scheduled[i].active = false;
+
+    if (strcmp(scheduled[i].action, "extend_for_time") == 0) {
+      motorController.extendForTime(scheduled[i].durationMs);
+    } else if (strcmp(scheduled[i].action, "retract_for_time") == 0) {
+      motorController.retractForTime(scheduled[i].durationMs);
+    } else {
+      handleCommand(scheduled[i].action);
+    }
+  }
+}
+
+bool CommandRouter::isEmergencyStop(const char* payload, size_t length) {
+  // Emergency payloads are tiny; anything bigger is regular work
+  char buf[128];
+  if (length == 0 || length >= sizeof(buf)) {
+    return false;
+  }
+  memcpy(buf, payload, length);
+  buf[length] = '\0';
+
+  // Bare token form ("stop" / "manual_stop"), ignoring surrounding whitespace
+  char* start = buf;
+  while (*start == ' ' || *start == '\t' || *start == '\r' || *start == '\n') start++;
+  char* end = start + strlen(start);
+  while (end > start && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r' || end[-1] == '\n')) *--end = '\0';
+  if (strcmp(start, "stop") == 0 || strcmp(start, "manual_stop") == 0) {
+    return true;
+  }
+
+  // JSON form: locate the quoted "action" value without parsing the document
+  const char* key = strstr(start, "\"action\"");
+  if (!key) return false;
+  const char* colon = strchr(key + 8, ':');
+  if (!colon) return false;
+  const char* open = strchr(colon, '"');
+  if (!open) return false;
+  const char* close = strchr(open + 1, '"');
+  if (!close) return false;
+  size_t valueLen = close - (open + 1);
+  return (valueLen == 4 && strncmp(open + 1, "stop", 4) == 0) ||
+         (valueLen == 11 && strncmp(open + 1, "manual_stop", 11) == 0);
+}
+
+void CommandRouter::handleCommand(const char* command) {
+  LOG_DEBUG("Router", "Handling command: %s", command);
+
+  // While an image is being flashed only the stop commands get through -
+  // starting a tap mid-write would fight the flash-cache stalls
+  if (OtaUpdater::isActive() && !isEmergencyStop(command, strlen(command))) {
+    LOG_WARN("Router", "Command '%s' dropped - OTA update in progress", command);
+    return;
+  }
+
+  uint32_t hash = fnv1aHashRuntime(command);
+  for (size_t i = 0; i < COMMAND_TABLE_SIZE; i++) {
+    if (COMMAND_TABLE[i].hash == hash && strcmp(COMMAND_TABLE[i].token, command) == 0) {
+      (motorController.*(COMMAND_TABLE[i].handler))();
+      return;
+    }
+  }
+
+  LOG_WARN("Router", "Unknown command: %s", command);
+}
+
+void CommandRouter::handleCommand(const String& command) {
+  handleCommand(command.c_str());
+}
+
 void CommandRouter::handleJsonCommand(const String& json) {
-  StaticJsonDocument<512> doc;
-  DeserializationError err = deserializeJson(doc, json);
+  // Convenience path for callers that still hold a String; the buffer is
+  // copied once so the zero-copy parser can modify it in place
+  char buffer[1024];
+  size_t length = json.length();
+  if (length >= sizeof(buffer)) {
+    LOG_WARN("Router", "JSON command too long");
+    return;
+  }
+  memcpy(buffer, json.c_str(), length + 1);
+  handleJsonCommand(buffer, length);
+}
+
+void CommandRouter::handleJsonCommand(char* json, size_t length) {
+  // 1KB to leave room for run_sequence step arrays. Parsing a mutable
+  // buffer puts ArduinoJson in zero-copy mode: string values point back
+  // into 'json' instead of being duplicated into the document pool.
+  StaticJsonDocument<1024> doc;
+  DeserializationError err = deserializeJson(doc, json, length);
 
   if (err) {
-    Serial.println("[Router] Invalid JSON received: " + String(err.c_str()));
+    LOG_WARN("Router", "Invalid JSON received: %s", err.c_str());
     return;
   }
 
   if (!doc.containsKey("action")) {
-    Serial.println("[Router] No 'action' in JSON");
+    LOG_WARN("Router", "No 'action' in JSON");
+    return;
+  }
+
+  // Read the action as a pointer into the parsed document - no String copy
+  const char* action = doc["action"];
+  LOG_DEBUG("Router", "JSON action: %s", action);
+
+  // Same OTA gate as handleCommand - only the stop commands act on a
+  // device that is mid-flash
+  if (OtaUpdater::isActive() && !isEmergencyStop(action, strlen(action))) {
+    LOG_WARN("Router", "Command '%s' dropped - OTA update in progress", action);
     return;
   }
 
-  String action = doc["action"].as<String>();
-  Serial.println("[Router] JSON Action: " + action);
+  // Group commands: a "stations" array limits execution to the listed
+  // station IDs - everyone else on the shared group topic ignores it
+  if (doc.containsKey("stations")) {
+    bool addressed = false;
+    for (JsonVariant id : doc["stations"].as<JsonArray>()) {
+      if (id.as<uint8_t>() == assignedStationId) {
+        addressed = true;
+        break;
+      }
+    }
+    if (!addressed) {
+      LOG_DEBUG("Router", "Group command not for station %u - ignored", assignedStationId);
+      return;
+    }
+  }
+
+  // Synchronized execution: "execute_at" (epoch ms) holds the command
+  // until the SNTP-aligned clock reaches it, so every station in a group
+  // fires within a motor tick of the same instant
+  if (doc.containsKey("execute_at")) {
+    uint64_t executeAt = doc["execute_at"].as<uint64_t>();
+    unsigned long durationMs = doc["duration_ms"] | 0UL;
+    if (scheduleCommand(action, durationMs, executeAt)) {
+      return;
+    }
+    // Fall through and execute immediately when scheduling is unavailable
+  }
 
   // Handle time-based commands (relay mimicking)
-  if (action == "extend_for_time") {
+  if (strcmp(action, "extend_for_time") == 0) {
     if (doc.containsKey("duration_ms")) {
       unsigned long duration = doc["duration_ms"].as<unsigned long>();
       motorController.extendForTime(duration);
     } else {
-      Serial.println("[Router] Missing duration_ms for extend_for_time");
+      LOG_WARN("Router", "Missing duration_ms for extend_for_time");
     }
-  } 
-  else if (action == "retract_for_time") {
+  }
+  else if (strcmp(action, "retract_for_time") == 0) {
     if (doc.containsKey("duration_ms")) {
       unsigned long duration = doc["duration_ms"].as<unsigned long>();
       motorController.retractForTime(duration);
     } else {
-      Serial.println("[Router] Missing duration_ms for retract_for_time");
+      LOG_WARN("Router", "Missing duration_ms for retract_for_time");
     }
   }
-  // Handle legacy tap command
-  else if (action == "tap") {
-    motorController.tap();
-  } 
-  // Handle basic commands
+  // Handle batch tap sequences
+  // Autonomous interval scheduler (endurance cadence without a harness)
+  else if (strcmp(action, "schedule") == 0) {
+    uint8_t card = doc["card"] | 1;
+    unsigned long intervalMs = doc["interval_ms"] | 0UL;
+    uint32_t count = doc["count"] | 0UL;
+    unsigned long jitterMs = doc["jitter_ms"] | 0UL;
+    motorController.startIntervalSchedule(card, intervalMs, count, jitterMs);
+  }
+  else if (strcmp(action, "cancel_schedule") == 0) {
+    motorController.cancelIntervalSchedule();
+  }
+  // Pre-position near a card so the following tap is just the final approach
+  else if (strcmp(action, "pre_position") == 0) {
+    uint8_t card = doc["card"] | 1;
+    motorController.prePosition(card);
+  }
+  // OTA pull trigger: the device fetches the image itself from the given
+  // URL (the download runs in the network task, not here)
+  else if (strcmp(action, "ota_update") == 0) {
+    const char* url = doc["url"];
+    const char* token = doc["token"];
+    OtaUpdater::requestPull(url, token);
+  }
+  else if (strcmp(action, "run_sequence") == 0) {
+    JsonArray steps = doc["steps"];
+    if (steps.isNull() || steps.size() == 0) {
+      LOG_WARN("Router", "Missing or empty 'steps' for run_sequence");
+      return;
+    }
+
+    MotorController::SequenceStep parsed[MotorController::MAX_SEQUENCE_STEPS];
+    size_t stepCount = 0;
+    for (JsonObject step : steps) {
+      if (stepCount >= MotorController::MAX_SEQUENCE_STEPS) {
+        LOG_WARN("Router", "run_sequence truncated to max steps");
+        break;
+      }
+      parsed[stepCount].card = step["card"] | 1;
+      parsed[stepCount].repeatCount = step["repeat"] | 1;
+      parsed[stepCount].interTapDelayMs = step["delay_ms"] | 0UL;
+      stepCount++;
+    }
+
+    motorController.startSequence(parsed, stepCount);
+  }
+  // Handle basic commands via the token table
   else {
     handleCommand(action);
   }
-}
\ No newline at end of file
+}
@@ -9,11 +9,71 @@ class CommandRouter {
 public:
   CommandRouter(MotorController& motor);
   void init();
-  void handleCommand(const String& command);
-  void handleJsonCommand(const String& json);
+  void handleCommand(const char* command);    // Allocation-free dispatch path
+  void handleCommand(const String& command);  // Convenience overload
+  void handleJsonCommand(char* json, size_t length);  // Parses in place, allocation-free
+  void handleJsonCommand(const String& json);         // Convenience overload
+
+  // NEW: Compact binary command frames
+  // Optional alternative to JSON over MQTT, published to the /command/bin
+  // topic suffix so the JSON path stays untouched for compatibility. A
+  // fixed little-endian 9-byte frame replaces a ~50-byte JSON document and
+  // skips the parse step entirely - decode is memcpy-and-validate.
+  struct __attribute__((packed)) BinaryCommandFrame {
+    uint8_t magic;        // BINARY_FRAME_MAGIC
+    uint8_t opcode;       // BinaryOpcode
+    uint16_t sequence;    // Producer sequence number (duplicate suppression)
+    uint32_t durationMs;  // Argument for the *_for_time opcodes, else 0
+    uint8_t crc;          // CRC-8/MAXIM over the preceding 8 bytes
+  };
+  static const uint8_t BINARY_FRAME_MAGIC = 0xB7;
+  enum BinaryOpcode : uint8_t {
+    BIN_OP_STOP = 0x00,
+    BIN_OP_EXTEND = 0x01,
+    BIN_OP_RETRACT = 0x02,
+    BIN_OP_TAP = 0x03,
+    BIN_OP_RESET_TO_MIDDLE = 0x04,
+    BIN_OP_TAP_CARD1 = 0x05,
+    BIN_OP_TAP_CARD2 = 0x06,
+    BIN_OP_EXTEND_FOR_TIME = 0x07,
+    BIN_OP_RETRACT_FOR_TIME = 0x08,
+  };
+  void handleBinaryCommand(const uint8_t* data, size_t length);
+  static uint8_t crc8(const uint8_t* data, size_t length);
+
+  // NEW: Fleet-synchronized scheduled execution
+  // Commands carrying an "execute_at" epoch-ms timestamp (typically from
+  // the shared group topic) are parked here and fired from the motor task
+  // once the SNTP-aligned clock reaches them, so every station in a group
+  // taps within a motor tick of the same instant. Covers the token-table
+  // commands plus the *_for_time pair; run_sequence executes immediately.
+  static const size_t MAX_SCHEDULED_COMMANDS = 4;
+  bool scheduleCommand(const char* action, unsigned long durationMs, uint64_t executeAtEpochMs);
+  void dispatchScheduled();  // Call in motor task
+
+  // NEW: Emergency lane classifier
+  // Transport handlers (HTTP body callback, MQTT callback) call this on the
+  // raw payload BEFORE queuing, so stop/manual_stop never wait behind
+  // in-flight work. Bounded scan, no JSON parse - accepts both the bare
+  // token and the {"action": "stop"} form. See MotorController::emergencyStop.
+  static bool isEmergencyStop(const char* payload, size_t length);
 
 private:
   MotorController& motorController;
+
+  // NEW: Binary frame duplicate suppression
+  uint16_t lastBinarySequence = 0;
+  bool haveBinarySequence = false;
+
+  // NEW: Parked scheduled commands (fireAtMs is a millis() deadline
+  // derived from the epoch delta at schedule time)
+  struct ScheduledCommand {
+    bool active;
+    char action[24];
+    unsigned long durationMs;
+    unsigned long fireAtMs;
+  };
+  ScheduledCommand scheduled[MAX_SCHEDULED_COMMANDS] = {};
 };
 
 #endif
\ No newline at end of file
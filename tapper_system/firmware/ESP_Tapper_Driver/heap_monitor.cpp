@@ -0,0 +1,80 @@
+#include "heap_monitor.h"
+#include "motor_controller.h"
+
+extern MotorController motorController;
+
+namespace HeapMonitor {
+
+static const unsigned long SAMPLE_INTERVAL_MS = 1000;
+// A new minimum has to undercut the last logged event by this much before
+// another event is recorded - keeps a slow leak from flooding the log
+static const uint32_t LOW_WATER_STEP_BYTES = 1024;
+
+struct LowWaterEvent {
+  unsigned long atMs;        // millis() when the new low was hit
+  uint32_t freeHeap;         // Free heap at that moment
+  uint32_t largestBlock;     // Largest allocatable block (fragmentation)
+  char operation[20];        // Motor operation active at the time
+};
+
+static LowWaterEvent events[MAX_LOW_WATER_EVENTS];
+static size_t eventCount = 0;      // Total events ever (ring wraps at MAX)
+static unsigned long lastSampleMs = 0;
+static uint32_t lastLoggedLow = 0xFFFFFFFF;
+
+uint32_t getFreeHeap() {
+  return ESP.getFreeHeap();
+}
+
+uint32_t getMinFreeHeap() {
+  return ESP.getMinFreeHeap();
+}
+
+uint32_t getLargestBlock() {
+  return ESP.getMaxAllocHeap();
+}
+
+void update() {
+  unsigned long now = millis();
+  if (now - lastSampleMs < SAMPLE_INTERVAL_MS) {
+    return;
+  }
+  lastSampleMs = now;
+
+  uint32_t minFree = ESP.getMinFreeHeap();
+  if (minFree + LOW_WATER_STEP_BYTES <= lastLoggedLow) {
+    lastLoggedLow = minFree;
+
+    LowWaterEvent& event = events[eventCount % MAX_LOW_WATER_EVENTS];
+    event.atMs = now;
+    event.freeHeap = ESP.getFreeHeap();
+    event.largestBlock = ESP.getMaxAllocHeap();
+    strncpy(event.operation, motorController.getOperationCString(), sizeof(event.operation) - 1);
+    event.operation[sizeof(event.operation) - 1] = '\0';
+    eventCount++;
+
+    Serial.println("[Heap] New low-water mark: " + String(minFree) + " bytes free (largest block " +
+                   String(event.largestBlock) + ") during " + String(event.operation));
+  }
+}
+
+void toJson(JsonDocument& doc) {
+  JsonObject heap = doc.createNestedObject("heap");
+  heap["free"] = ESP.getFreeHeap();
+  heap["min_free"] = ESP.getMinFreeHeap();
+  heap["largest_block"] = ESP.getMaxAllocHeap();
+
+  JsonArray log = heap.createNestedArray("low_water_events");
+  size_t count = (eventCount < MAX_LOW_WATER_EVENTS) ? eventCount : MAX_LOW_WATER_EVENTS;
+  size_t start = eventCount - count;  // Oldest surviving entry
+  for (size_t i = 0; i < count; i++) {
+    const LowWaterEvent& event = events[(start + i) % MAX_LOW_WATER_EVENTS];
+    JsonObject entry = log.createNestedObject();
+    entry["at_ms"] = event.atMs;
+    entry["free"] = event.freeHeap;
+    entry["largest_block"] = event.largestBlock;
+    entry["operation"] = event.operation;
+  }
+}
+
+}  // namespace HeapMonitor
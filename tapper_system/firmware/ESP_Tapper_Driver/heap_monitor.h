@@ -0,0 +1,30 @@
+// heap_monitor.h - Heap health monitoring
+// Samples free heap, minimum-ever free heap, and the largest allocatable
+// block on a fixed interval, and keeps a small in-RAM log of low-water
+// events tagged with the motor operation active at the time. Soak-run
+// reboots from heap exhaustion become a dashboard graph (and a pointer at
+// the command path responsible) instead of a multi-day hunt.
+#ifndef HEAP_MONITOR_H
+#define HEAP_MONITOR_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+namespace HeapMonitor {
+  static const size_t MAX_LOW_WATER_EVENTS = 8;
+
+  // Called periodically from the network task; samples once per second
+  // internally, so the call itself is nearly free.
+  void update();
+
+  // Current snapshot accessors (also sampled fresh, not cached).
+  uint32_t getFreeHeap();
+  uint32_t getMinFreeHeap();
+  uint32_t getLargestBlock();
+
+  // Fills a "heap" object (free/min_free/largest_block/low_water_events)
+  // into the given document - used by /api/detailed_status.
+  void toJson(JsonDocument& doc);
+}
+
+#endif
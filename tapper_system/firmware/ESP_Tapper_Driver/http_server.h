@@ -1,16 +1,51 @@
 #pragma once
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
 #include "command_router.h"
 
+// NEW: Rebuilt on ESPAsyncWebServer. Requests are serviced from the async
+// TCP event task as they arrive, so a dashboard polling /status can never
+// queue a /command POST behind it, and streaming /index.html from SPIFFS
+// no longer blocks tap commands.
 class HTTPServer {
 public:
   HTTPServer(CommandRouter& router);
   void init();
-  void loop();
-  void serveIndex();
+  void serveIndex(AsyncWebServerRequest* request);
 
+  // NEW: Push-based status. The network task calls this each pass; when
+  // the motor status version has moved since the last push, subscribers
+  // on /events get a status frame within one network tick of the
+  // transition instead of polling /status at 2Hz.
+  void pollStatusEvents();
 
 private:
-  WebServer server{ 80 };
+  AsyncWebServer server{ 80 };
+  AsyncEventSource events{ "/events" };  // Server-sent events channel
   CommandRouter& commandRouter;
-};
\ No newline at end of file
+
+  // NEW: Connection reuse on the command path. The async server keeps
+  // HTTP/1.1 connections open across requests (each client socket is
+  // independent, so a pool of warm orchestrator connections just works);
+  // command responses advertise the policy explicitly so clients hold
+  // their socket instead of reconnecting per command.
+  void sendCommandResponse(AsyncWebServerRequest* request, int code, const char* body);
+
+  // Legacy GET endpoints enqueue like /command does - the motor state
+  // machine lives on core 1 and only the motor task may drive it, so the
+  // async handler task never dispatches inline. stop/manual_stop take
+  // the emergency lane, also like /command.
+  void enqueueSimpleCommand(AsyncWebServerRequest* request, const char* action, const char* okText);
+
+  // NEW: Cached status snapshots. Rebuilt only when the motor status
+  // version changes; unchanged polls are answered from the cache (or with
+  // a 304 when the client sent a matching ETag). The caches are shared
+  // between the async handler task and the network task, so every
+  // refresh/read holds cacheMutex - never taken on the motor core.
+  void refreshStatusCaches();  // Caller must hold cacheMutex
+  SemaphoreHandle_t cacheMutex = nullptr;
+  String cachedStatusText;
+  String cachedDetailedJson;
+  String cachedStatusEtag;
+  uint32_t cachedStatusVersion = 0;
+  uint32_t lastPushedVersion = 0;
+};
@@ -0,0 +1,67 @@
+#include "logger.h"
+
+#include <stdarg.h>
+
+namespace Logger {
+
+struct Line {
+  char text[MAX_LINE_LENGTH];
+};
+
+static Line ring[RING_CAPACITY];
+static volatile size_t head = 0;  // Consumed by drain() (network task)
+static volatile size_t tail = 0;  // Produced by log() (any core)
+static uint32_t dropped = 0;
+static portMUX_TYPE ringMux = portMUX_INITIALIZER_UNLOCKED;
+static void (*extraSink)(const char* line) = nullptr;
+
+void log(uint8_t level, const char* tag, const char* fmt, ...) {
+  // Format outside the critical section; only the slot copy is locked
+  char text[MAX_LINE_LENGTH];
+  int offset = snprintf(text, sizeof(text), "[%s] ", tag);
+  if (offset < 0 || (size_t)offset >= sizeof(text)) {
+    offset = 0;
+  }
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(text + offset, sizeof(text) - offset, fmt, args);
+  va_end(args);
+
+  taskENTER_CRITICAL(&ringMux);
+  size_t nextTail = (tail + 1) & (RING_CAPACITY - 1);
+  if (nextTail == head) {
+    // Full - dropping beats blocking the caller on the UART
+    dropped = dropped + 1;
+    taskEXIT_CRITICAL(&ringMux);
+    return;
+  }
+  memcpy(ring[tail].text, text, sizeof(text));
+  tail = nextTail;
+  taskEXIT_CRITICAL(&ringMux);
+}
+
+void drain() {
+  while (head != tail) {
+    Line line;
+    taskENTER_CRITICAL(&ringMux);
+    line = ring[head];
+    head = (head + 1) & (RING_CAPACITY - 1);
+    taskEXIT_CRITICAL(&ringMux);
+
+    Serial.println(line.text);
+    if (extraSink) {
+      extraSink(line.text);
+    }
+  }
+
+  if (dropped > 0) {
+    Serial.println("[Logger] Dropped " + String(dropped) + " lines (ring full)");
+    dropped = 0;
+  }
+}
+
+void setSink(void (*sink)(const char* line)) {
+  extraSink = sink;
+}
+
+}  // namespace Logger
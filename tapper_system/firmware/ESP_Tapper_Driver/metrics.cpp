@@ -0,0 +1,112 @@
+#include "metrics.h"
+
+namespace {
+
+// Bucket upper bounds in microseconds; the last bucket catches overflow.
+// Log-spaced so the same table covers 50us dispatches and 5s tap cycles.
+const unsigned long BUCKET_BOUNDS_US[] = {
+  50, 100, 200, 500,
+  1000, 2000, 5000, 10000, 20000, 50000,
+  100000, 200000, 500000,
+  1000000, 2000000, 5000000
+};
+const size_t BUCKET_BOUND_COUNT = sizeof(BUCKET_BOUNDS_US) / sizeof(BUCKET_BOUNDS_US[0]);
+const size_t BUCKET_COUNT = BUCKET_BOUND_COUNT + 1;  // +1 overflow bucket
+
+struct Histogram {
+  uint32_t buckets[BUCKET_COUNT] = { 0 };
+  uint32_t count = 0;
+  unsigned long minUs = 0;
+  unsigned long maxUs = 0;
+  uint64_t sumUs = 0;
+};
+
+// Updated from the motor task, read from the HTTP task; a torn read only
+// skews a single poll of a diagnostic counter, so no locking.
+Histogram histograms[Metrics::STAGE_COUNT];
+
+const char* STAGE_NAMES[Metrics::STAGE_COUNT] = {
+  "queue_wait", "dispatch", "actuation", "tap_cycle"
+};
+
+// Per-command clock for the dispatch/actuation stages
+unsigned long commandStartUs = 0;
+bool commandActive = false;
+bool actuationRecorded = false;
+
+unsigned long percentile(const Histogram& hist, uint8_t pct) {
+  if (hist.count == 0) return 0;
+  uint32_t threshold = ((uint64_t)hist.count * pct + 99) / 100;
+  uint32_t cumulative = 0;
+  for (size_t i = 0; i < BUCKET_COUNT; i++) {
+    cumulative += hist.buckets[i];
+    if (cumulative >= threshold) {
+      return (i < BUCKET_BOUND_COUNT) ? BUCKET_BOUNDS_US[i] : hist.maxUs;
+    }
+  }
+  return hist.maxUs;
+}
+
+}  // namespace
+
+namespace Metrics {
+
+void record(Stage stage, unsigned long durationUs) {
+  Histogram& hist = histograms[stage];
+
+  size_t bucket = BUCKET_BOUND_COUNT;  // Overflow by default
+  for (size_t i = 0; i < BUCKET_BOUND_COUNT; i++) {
+    if (durationUs <= BUCKET_BOUNDS_US[i]) {
+      bucket = i;
+      break;
+    }
+  }
+
+  hist.buckets[bucket]++;
+  if (hist.count == 0 || durationUs < hist.minUs) hist.minUs = durationUs;
+  if (durationUs > hist.maxUs) hist.maxUs = durationUs;
+  hist.sumUs += durationUs;
+  hist.count++;
+}
+
+void markCommandReceived(unsigned long enqueuedAtUs) {
+  unsigned long now = micros();
+  record(STAGE_QUEUE_WAIT, now - enqueuedAtUs);
+  commandStartUs = now;
+  commandActive = true;
+  actuationRecorded = false;
+}
+
+void recordDispatchDone() {
+  if (!commandActive) return;
+  record(STAGE_DISPATCH, micros() - commandStartUs);
+  commandActive = false;
+}
+
+void recordActuation() {
+  // Only the first GPIO transition of a command counts; a tap sequence
+  // toggles the pins several times afterwards on its own clock
+  if (!commandActive || actuationRecorded) return;
+  record(STAGE_ACTUATION, micros() - commandStartUs);
+  actuationRecorded = true;
+}
+
+void recordTapCycle(unsigned long durationUs) {
+  record(STAGE_TAP_CYCLE, durationUs);
+}
+
+void toJson(JsonDocument& doc) {
+  for (size_t stage = 0; stage < STAGE_COUNT; stage++) {
+    const Histogram& hist = histograms[stage];
+    JsonObject obj = doc.createNestedObject(STAGE_NAMES[stage]);
+    obj["count"] = hist.count;
+    obj["min_us"] = hist.minUs;
+    obj["max_us"] = hist.maxUs;
+    obj["avg_us"] = hist.count ? (unsigned long)(hist.sumUs / hist.count) : 0;
+    obj["p50_us"] = percentile(hist, 50);
+    obj["p95_us"] = percentile(hist, 95);
+    obj["p99_us"] = percentile(hist, 99);
+  }
+}
+
+}  // namespace Metrics
@@ -0,0 +1,42 @@
+// metrics.h - Per-command latency instrumentation
+// Replaces the ad-hoc millis() Serial prints with fixed-bucket histograms
+// accumulated in RAM: time spent waiting in the command queue, dispatch
+// time in CommandRouter, receive-to-GPIO actuation latency, and full tap
+// cycle duration. p50/p95/p99 per stage are served by /api/metrics.
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+namespace Metrics {
+  enum Stage {
+    STAGE_QUEUE_WAIT,  // Enqueue (HTTP/MQTT receive) -> dequeue in motor task
+    STAGE_DISPATCH,    // Dequeue -> CommandRouter done
+    STAGE_ACTUATION,   // Dequeue -> first motor GPIO transition
+    STAGE_TAP_CYCLE,   // Dual card operation start -> complete
+    STAGE_COUNT
+  };
+
+  // Called by the motor task when it pulls a command off the queue;
+  // records queue wait and starts the per-command clock.
+  void markCommandReceived(unsigned long enqueuedAtUs);
+
+  // Called by CommandRouter after dispatch returns.
+  void recordDispatchDone();
+
+  // Called by MotorController on the first GPIO transition of the
+  // current command (subsequent transitions of the same command are ignored).
+  void recordActuation();
+
+  // Called when a dual card operation completes.
+  void recordTapCycle(unsigned long durationUs);
+
+  // Raw histogram record (used by the stages above).
+  void record(Stage stage, unsigned long durationUs);
+
+  // Serialize count/min/max/avg/p50/p95/p99 per stage.
+  void toJson(JsonDocument& doc);
+}
+
+#endif
@@ -1,58 +1,310 @@
 #include "motor_controller.h"
 #include "mqtt_handler.h"
+#include "metrics.h"
+#include "logger.h"
 #include <Arduino.h>
 
 #define IN1_PIN 12
 #define IN2_PIN 13
 
+// NEW: Optional closed-loop feedback hardware
+// Define the pins on units fitted with the sense hardware; leave them
+// undefined on stock units and timing stays the sole authority.
+// #define CURRENT_SENSE_PIN 34      // ADC1 input from the shunt amplifier
+// #define LIMIT_SWITCH_EXT_PIN 25   // Active-low, closes at full extension
+// #define LIMIT_SWITCH_RET_PIN 26   // Active-low, closes at full retraction
+
+#ifdef CURRENT_SENSE_PIN
+// Raw 12-bit ADC thresholds, tuned on the bench against the shunt amplifier
+static const float CURRENT_EWMA_ALPHA = 0.2f;            // Smoothing factor
+static const float CURRENT_ARRIVAL_THRESHOLD = 1800.0f;  // Load rise pressing a card
+static const float CURRENT_STALL_THRESHOLD = 3000.0f;    // Jammed mechanism
+static const unsigned long FEEDBACK_SAMPLE_INTERVAL_US = 2000;  // 500 Hz sampling
+static const unsigned long FEEDBACK_BLANKING_US = 150000;       // Skip inrush spike
+#endif
+
 extern MQTTHandler mqttHandler;
 
+void MotorController::bumpStatusVersion() {
+  // Just the counter - the network task polls it and does the snapshot
+  // rebuild and SSE push over there, so the motor tick never touches the
+  // shared caches or builds JSON
+  statusVersion = statusVersion + 1;
+}
+
 void MotorController::init() {
   pinMode(IN1_PIN, OUTPUT);
   pinMode(IN2_PIN, OUTPUT);
   stop();
 
+  // Load per-device timing overrides from NVS before anything moves
+  calibration.load();
+
+#ifdef CURRENT_SENSE_PIN
+  pinMode(CURRENT_SENSE_PIN, INPUT);
+#endif
+#ifdef LIMIT_SWITCH_EXT_PIN
+  pinMode(LIMIT_SWITCH_EXT_PIN, INPUT_PULLUP);
+#endif
+#ifdef LIMIT_SWITCH_RET_PIN
+  pinMode(LIMIT_SWITCH_RET_PIN, INPUT_PULLUP);
+#endif
+
   // Initialize dual card state
   currentPosition = UNKNOWN;
   previousPosition = UNKNOWN;
   currentOperation = IDLE;
 
+  // Create the one-shot stop timers (esp_timer callbacks run in a
+  // high-priority task, so the GPIO stop is not delayed by loop() work)
+  esp_timer_create_args_t timedOpArgs = {};
+  timedOpArgs.callback = &MotorController::onTimedOpTimer;
+  timedOpArgs.arg = this;
+  timedOpArgs.name = "motor_timed_stop";
+  esp_timer_create(&timedOpArgs, &timedOpTimer);
+
+  esp_timer_create_args_t phaseArgs = {};
+  phaseArgs.callback = &MotorController::onPhaseTimer;
+  phaseArgs.arg = this;
+  phaseArgs.name = "motor_phase";
+  esp_timer_create(&phaseArgs, &phaseTimer);
+
   Serial.println("[Motor] Enhanced dual card relay-mimicking controller initialized");
   Serial.println("  - Dual card support with position tracking");
   Serial.println("  - Timing-based positioning (no sensors)");
   Serial.println("  - Measured timing constants for accurate positioning");
   Serial.println("  - Power-aware timing (12V/USB modes)");
+  Serial.println("  - Hardware-timer motor stops (microsecond accuracy)");
+  if (isFeedbackEnabled()) {
+    Serial.println("  - Closed-loop feedback enabled (current sense / limit switches)");
+  }
+}
+
+// ============ NEW: CLOSED-LOOP FEEDBACK ============
+
+bool MotorController::isFeedbackEnabled() const {
+#if defined(CURRENT_SENSE_PIN) || defined(LIMIT_SWITCH_EXT_PIN) || defined(LIMIT_SWITCH_RET_PIN)
+  return true;
+#else
+  return false;
+#endif
+}
+
+void MotorController::updateFeedbackSampling() {
+  if (currentState == STATE_IDLE) {
+    motorCurrentEwma = 0.0f;
+    feedbackArrivalLatched = false;
+    return;
+  }
+
+#ifdef CURRENT_SENSE_PIN
+  unsigned long nowUs = micros();
+  if (nowUs - lastFeedbackSampleUs >= FEEDBACK_SAMPLE_INTERVAL_US) {
+    lastFeedbackSampleUs = nowUs;
+    float sample = (float)analogRead(CURRENT_SENSE_PIN);
+    motorCurrentEwma += CURRENT_EWMA_ALPHA * (sample - motorCurrentEwma);
+
+    // Blank out the inrush spike right after the motor energizes
+    if (safeElapsedMicros(dualCardOperationStartTime) >= FEEDBACK_BLANKING_US) {
+      if (motorCurrentEwma >= CURRENT_STALL_THRESHOLD) {
+        // Jammed mechanism - de-energize immediately and drop position
+        // tracking; the next command will force a full reset sequence
+        LOG_WARN("Feedback", "Stall current detected - emergency stop");
+        stop();
+        cancelPhaseTimer();
+        currentOperation = IDLE;
+        currentPosition = UNKNOWN;
+        // Kill any batch driver as well, or its next deadline would push
+        // straight back into the jam
+        sequenceActive = false;
+        sequenceTapInFlight = false;
+        scheduleActive = false;
+        scheduleTapInFlight = false;
+        benchActive = false;
+        benchTapInFlight = false;
+        prePositionOnly = false;
+        mqttHandler.publishStatus("stall_detected");
+        return;
+      }
+
+      // Load current rises when the tapper presses the card, well before
+      // the worst-case timed deadline on a healthy unit
+      if ((currentOperation == MOVING_TO_CARD1 || currentOperation == MOVING_TO_CARD2) &&
+          motorCurrentEwma >= CURRENT_ARRIVAL_THRESHOLD) {
+        feedbackArrivalLatched = true;
+      }
+    }
+  }
+#endif
+
+#ifdef LIMIT_SWITCH_EXT_PIN
+  // Hard end stop - arrival for full-travel moves, overshoot guard otherwise
+  if (currentState == STATE_EXTENDING && digitalRead(LIMIT_SWITCH_EXT_PIN) == LOW) {
+    feedbackArrivalLatched = true;
+  }
+#endif
+#ifdef LIMIT_SWITCH_RET_PIN
+  if (currentState == STATE_RETRACTING && digitalRead(LIMIT_SWITCH_RET_PIN) == LOW) {
+    feedbackArrivalLatched = true;
+  }
+#endif
+}
+
+bool MotorController::feedbackArrivalDetected() {
+  if (!feedbackArrivalLatched) {
+    return false;
+  }
+  feedbackArrivalLatched = false;
+  // The phase timer has not fired yet - de-energize here and cancel the
+  // stale deadline so it cannot leak into the next phase
+  digitalWrite(IN1_PIN, LOW);
+  digitalWrite(IN2_PIN, LOW);
+  cancelPhaseTimer();
+  LOG_INFO("Feedback", "Arrival detected before timed deadline");
+  return true;
+}
+
+// ============ NEW: HARDWARE TIMER STOPS ============
+
+void MotorController::onTimedOpTimer(void* arg) {
+  MotorController* self = static_cast<MotorController*>(arg);
+  // De-energize immediately - bookkeeping happens in updateTimedOperations()
+  digitalWrite(IN1_PIN, LOW);
+  digitalWrite(IN2_PIN, LOW);
+  self->timedOpTimerFired = true;
+}
+
+void MotorController::onPhaseTimer(void* arg) {
+  MotorController* self = static_cast<MotorController*>(arg);
+  if (self->phaseStopsMotor) {
+    digitalWrite(IN1_PIN, LOW);
+    digitalWrite(IN2_PIN, LOW);
+  }
+  self->phaseTimerFired = true;
+}
+
+void MotorController::armTimedOpTimer(unsigned long delayUs) {
+  cancelTimedOpTimer();
+  esp_timer_start_once(timedOpTimer, delayUs);
+}
+
+void MotorController::armPhaseTimer(unsigned long delayUs, bool stopMotorOnFire) {
+  cancelPhaseTimer();
+  phaseStopsMotor = stopMotorOnFire;
+  esp_timer_start_once(phaseTimer, delayUs);
+}
+
+void MotorController::cancelTimedOpTimer() {
+  if (timedOpTimer) {
+    esp_timer_stop(timedOpTimer);  // Returns an error if not armed - harmless
+  }
+  timedOpTimerFired = false;
+}
+
+void MotorController::cancelPhaseTimer() {
+  if (phaseTimer) {
+    esp_timer_stop(phaseTimer);
+  }
+  phaseTimerFired = false;
+}
+
+bool MotorController::consumePhaseTimer() {
+  if (!phaseTimerFired) {
+    return false;
+  }
+  phaseTimerFired = false;
+  return true;
 }
 
 // ============ BASIC MOTOR CONTROLS ============
 void MotorController::extend() {
   digitalWrite(IN1_PIN, HIGH);
   digitalWrite(IN2_PIN, LOW);
+  Metrics::recordActuation();
   currentState = STATE_EXTENDING;
-  Serial.println("[Motor] Extending...");
+  bumpStatusVersion();
+  LOG_INFO("Motor", "Extending...");
   mqttHandler.publishStatus("extending");
 }
 
 void MotorController::retract() {
   digitalWrite(IN1_PIN, LOW);
   digitalWrite(IN2_PIN, HIGH);
+  Metrics::recordActuation();
   currentState = STATE_RETRACTING;
-  Serial.println("[Motor] Retracting...");
+  bumpStatusVersion();
+  LOG_INFO("Motor", "Retracting...");
   mqttHandler.publishStatus("retracting");
 }
 
 void MotorController::stop() {
   digitalWrite(IN1_PIN, LOW);
   digitalWrite(IN2_PIN, LOW);
+  Metrics::recordActuation();
   currentState = STATE_IDLE;
-  Serial.println("[Motor] Stopped");
+  bumpStatusVersion();
+  LOG_INFO("Motor", "Stopped");
   mqttHandler.publishStatus("idle");
 }
 
+// ============ NEW: EMERGENCY LANE ============
+
+void MotorController::emergencyStop() {
+  // Runs on whatever core took the request - keep it to the GPIO writes
+  // and a flag. Every millisecond the actuator keeps pushing into a jammed
+  // card matters; bookkeeping waits for the motor task.
+  digitalWrite(IN1_PIN, LOW);
+  digitalWrite(IN2_PIN, LOW);
+  emergencyStopAtUs = micros();
+  emergencyStopRequested = true;
+}
+
+void MotorController::serviceEmergencyStop() {
+  if (!emergencyStopRequested) return;
+  emergencyStopRequested = false;
+
+  LOG_WARN("Motor", "EMERGENCY STOP - aborting all operations");
+  cancelTimedOpTimer();
+  cancelPhaseTimer();
+  timedOperation = false;
+  tapState = TAP_IDLE;
+  sequenceActive = false;
+  sequenceTapInFlight = false;
+  // Schedules and benches must die here too - leaving them active only
+  // pauses them, and the next deadline would re-energize a mechanism that
+  // was just stopped for a jam
+  scheduleActive = false;
+  scheduleTapInFlight = false;
+  benchActive = false;
+  benchTapInFlight = false;
+  prePositionOnly = false;
+
+  // A stop mid-travel leaves the actuator somewhere between positions;
+  // a stop during a pause (motor already off) keeps the known position
+  if (currentOperation == MOVING_TO_MIDDLE ||
+      currentOperation == MOVING_TO_CARD1 ||
+      currentOperation == MOVING_TO_CARD2) {
+    currentPosition = UNKNOWN;
+  }
+  currentOperation = IDLE;
+
+  // manual_stop rides this lane too, so the calibration flow ends here:
+  // finish the measurement manual_extend/manual_retract started, using
+  // the timestamp taken at de-energize (not this tick, ~1ms later)
+  if (timingMeasurementActive) {
+    lastMeasuredUs = emergencyStopAtUs - manualTimingStart;
+    lastMeasuredFresh = true;
+    timingMeasurementActive = false;
+    LOG_INFO("Timing", "Captured %lums - apply via POST /api/calibration", lastMeasuredUs / 1000);
+  }
+
+  stop();  // GPIO already low; updates state, status version, MQTT
+}
+
 // ============ TIME-BASED OPERATIONS (RELAY MIMICKING) ============
 
 void MotorController::extendForTime(unsigned long duration_ms) {
-  Serial.println("[Motor] Extend for " + String(duration_ms) + "ms");
+  LOG_INFO("Motor", "Extend for %lums", duration_ms);
 
   // Stop any current timed operation
   if (timedOperation) {
@@ -66,10 +318,11 @@ void MotorController::extendForTime(unsigned long duration_ms) {
   operationDuration = duration_ms;
   timedOperationState = STATE_EXTENDING;
   timedOperation = true;
+  armTimedOpTimer(duration_ms * 1000UL);  // Hardware-accurate stop
 }
 
 void MotorController::retractForTime(unsigned long duration_ms) {
-  Serial.println("[Motor] Retract for " + String(duration_ms) + "ms");
+  LOG_INFO("Motor", "Retract for %lums", duration_ms);
 
   // Stop any current timed operation
   if (timedOperation) {
@@ -83,6 +336,7 @@ void MotorController::retractForTime(unsigned long duration_ms) {
   operationDuration = duration_ms;
   timedOperationState = STATE_RETRACTING;
   timedOperation = true;
+  armTimedOpTimer(duration_ms * 1000UL);  // Hardware-accurate stop
 }
 
 void MotorController::updateTimedOperations() {
@@ -90,8 +344,12 @@ void MotorController::updateTimedOperations() {
 
   unsigned long elapsed = (micros() - operationStartTime) / 1000;
 
-  if (elapsed >= operationDuration) {
-    Serial.println("[Motor] Timed operation complete (" + String(elapsed) + "ms)");
+  // The esp_timer callback already de-energized the GPIOs at the exact
+  // deadline; this path only does the bookkeeping. The elapsed check stays
+  // as a fallback in case the timer failed to arm.
+  if (timedOpTimerFired || elapsed >= operationDuration) {
+    timedOpTimerFired = false;
+    LOG_INFO("Motor", "Timed operation complete (%lums)", elapsed);
     stop();
     timedOperation = false;
 
@@ -112,7 +370,7 @@ void MotorController::updateTimedOperations() {
 
 // ============ LEGACY TAP FUNCTIONS (SIMPLIFIED) ============
 void MotorController::startTap() {
-  Serial.println("[Motor] Starting legacy tap sequence");
+  LOG_INFO("Motor", "Starting legacy tap sequence");
   extend();
   tapState = TAP_EXTENDING;
   tapStartTime = micros();
@@ -126,7 +384,7 @@ void MotorController::updateTap() {
   switch (tapState) {
     case TAP_EXTENDING:
       if ((currentTime - tapStartTime) / 1000 > tapTimeout) {
-        Serial.println("[Motor] Legacy tap: Extend timeout, pausing");
+        LOG_DEBUG("Motor", "Legacy tap: Extend timeout, pausing");
         stop();
         tapState = TAP_PAUSE;
         tapStartTime = currentTime;
@@ -135,7 +393,7 @@ void MotorController::updateTap() {
 
     case TAP_PAUSE:
       if ((currentTime - tapStartTime) / 1000 > tapPauseDelay) {
-        Serial.println("[Motor] Legacy tap: Starting retract");
+        LOG_DEBUG("Motor", "Legacy tap: Starting retract");
         retract();
         tapState = TAP_RETRACTING;
         tapStartTime = currentTime;
@@ -144,14 +402,14 @@ void MotorController::updateTap() {
 
     case TAP_RETRACTING:
       if ((currentTime - tapStartTime) / 1000 > tapTimeout) {
-        Serial.println("[Motor] Legacy tap: Retract timeout, stopping");
+        LOG_DEBUG("Motor", "Legacy tap: Retract timeout, stopping");
         stop();
         tapState = TAP_COMPLETE;
       }
       break;
 
     case TAP_COMPLETE:
-      Serial.println("[Motor] Legacy tap sequence completed");
+      LOG_INFO("Motor", "Legacy tap sequence completed");
       tapState = TAP_IDLE;
       mqttHandler.publishStatus("idle");
       break;
@@ -217,7 +475,7 @@ void MotorController::checkLimitSwitches() {
     if (moveStartTime == 0) {
       moveStartTime = micros();
     } else if ((micros() - moveStartTime) / 1000 > 5000) {  // 5 second safety timeout
-      Serial.println("[Motor] Safety timeout - AUTO STOP (uncontrolled movement)");
+      LOG_WARN("Motor", "Safety timeout - AUTO STOP (uncontrolled movement)");
       stop();
       moveStartTime = 0;
     }
@@ -230,79 +488,162 @@ void MotorController::checkLimitSwitches() {
 
 void MotorController::resetToMiddle() {
   if (currentOperation != IDLE) {
-    Serial.println("[DualCard] Cannot reset - operation in progress");
+    LOG_WARN("DualCard", "Cannot reset - operation in progress");
     return;
   }
 
-  Serial.println("[DualCard] Resetting to middle position from: " + getPositionString());
+  LOG_INFO("DualCard", "Resetting to middle from %s", getPositionCString());
 
   if (currentPosition == MIDDLE) {
-    Serial.println("[DualCard] Already at middle position");
+    LOG_INFO("DualCard", "Already at middle position");
     return;
   }
 
   if (currentPosition == CARD1) {
     // From Card 1 (extended), retract to middle
-    Serial.println("[DualCard] From Card 1: retracting " + String(getCard1ToHomeMs()) + "ms to middle");
+    LOG_INFO("DualCard", "From Card 1: retracting %lums to middle", getCard1ToHomeMs());
     retract();
+    startDualCardOperation(MOVING_TO_MIDDLE);
+    armPhaseTimer(getCard1ToHomeMs() * 1000UL, true);
   } else if (currentPosition == CARD2) {
     // From Card 2 (retracted), extend to middle
-    Serial.println("[DualCard] From Card 2: extending " + String(getCard2ToHomeMs()) + "ms to middle");
+    LOG_INFO("DualCard", "From Card 2: extending %lums to middle", getCard2ToHomeMs());
     extend();
+    startDualCardOperation(MOVING_TO_MIDDLE);
+    armPhaseTimer(getCard2ToHomeMs() * 1000UL, true);
+  } else if (currentPosition == NEAR_CARD1) {
+    // From the near point, reverse the same fraction of the return leg
+    unsigned long backMs = getCard1ToHomeMs() * PRE_POSITION_TRAVEL_PCT / 100;
+    LOG_INFO("DualCard", "From near Card 1: retracting %lums to middle", backMs);
+    retract();
+    startDualCardOperation(MOVING_TO_MIDDLE);
+    armPhaseTimer(backMs * 1000UL, true);
+  } else if (currentPosition == NEAR_CARD2) {
+    unsigned long backMs = getCard2ToHomeMs() * PRE_POSITION_TRAVEL_PCT / 100;
+    LOG_INFO("DualCard", "From near Card 2: extending %lums to middle", backMs);
+    extend();
+    startDualCardOperation(MOVING_TO_MIDDLE);
+    armPhaseTimer(backMs * 1000UL, true);
   } else {
     // Unknown position - full retract first, then partial extend to middle
-    Serial.println("[DualCard] Unknown position, doing full reset sequence");
+    LOG_INFO("DualCard", "Unknown position, doing full reset sequence");
     retract();  // Will timeout and extend to middle
+    startDualCardOperation(MOVING_TO_MIDDLE);
+    armPhaseTimer(getRetractFullMs() * 1000UL, false);  // Step 1 reverses, no stop
   }
-
-  startDualCardOperation(MOVING_TO_MIDDLE);
 }
 
 void MotorController::tapCard1() {
   if (currentOperation != IDLE) {
-    Serial.println("[DualCard] Cannot tap Card 1 - operation in progress");
+    LOG_WARN("DualCard", "Cannot tap Card 1 - operation in progress");
     return;
   }
 
-  Serial.println("[DualCard] Starting Card 1 tap - extend from middle");
-  Serial.println("[DualCard] Sequence: extend " + String(getCard1FromHomeMs()) + "ms → pause " + String(getCard1TapPauseMs()) + "ms → retract " + String(getCard1ToHomeMs()) + "ms");
-  Serial.println("[DualCard] Power mode: " + getPowerSourceString());
+  LOG_INFO("DualCard", "Starting Card 1 tap - extend from middle");
+  LOG_DEBUG("DualCard", "Sequence: extend %lums -> pause %lums -> retract %lums",
+            getCard1FromHomeMs(), getCard1TapPauseMs(), getCard1ToHomeMs());
+  LOG_DEBUG("DualCard", "Power mode: %s", getPowerSourceCString());
+
+  if (currentPosition == NEAR_CARD1) {
+    // Pre-positioned: only the final approach remains
+    unsigned long approachMs = getCard1FromHomeMs() - getCard1NearMs();
+    LOG_INFO("DualCard", "Step 1: Final approach to Card 1 (%lums)", approachMs);
+    extend();
+    startDualCardOperation(MOVING_TO_CARD1);
+    armPhaseTimer(approachMs * 1000UL, true);
+    return;
+  }
 
   if (currentPosition != MIDDLE) {
-    Serial.println("[DualCard] Must be at middle position first - resetting");
+    LOG_INFO("DualCard", "Must be at middle position first - resetting");
     resetToMiddle();
     return;
   }
 
   // Card 1 = Extended position from middle
-  Serial.println("[DualCard] Step 1: Extending to Card 1 position...");
+  LOG_INFO("DualCard", "Step 1: Extending to Card 1 position");
   extend();
   startDualCardOperation(MOVING_TO_CARD1);
+  armPhaseTimer(getCard1FromHomeMs() * 1000UL, true);  // Stop exactly at the card
 }
 
 void MotorController::tapCard2() {
   if (currentOperation != IDLE) {
-    Serial.println("[DualCard] Cannot tap Card 2 - operation in progress");
+    LOG_WARN("DualCard", "Cannot tap Card 2 - operation in progress");
     return;
   }
 
-  Serial.println("[DualCard] Starting Card 2 tap - retract from middle");
-  Serial.println("[DualCard] Sequence: retract " + String(getCard2FromHomeMs()) + "ms → pause " + String(getCard2TapPauseMs()) + "ms → extend " + String(getCard2ToHomeMs()) + "ms");
-  Serial.println("[DualCard] Power mode: " + getPowerSourceString());
+  LOG_INFO("DualCard", "Starting Card 2 tap - retract from middle");
+  LOG_DEBUG("DualCard", "Sequence: retract %lums -> pause %lums -> extend %lums",
+            getCard2FromHomeMs(), getCard2TapPauseMs(), getCard2ToHomeMs());
+  LOG_DEBUG("DualCard", "Power mode: %s", getPowerSourceCString());
+
+  if (currentPosition == NEAR_CARD2) {
+    // Pre-positioned: only the final approach remains
+    unsigned long approachMs = getCard2FromHomeMs() - getCard2NearMs();
+    LOG_INFO("DualCard", "Step 1: Final approach to Card 2 (%lums)", approachMs);
+    retract();
+    startDualCardOperation(MOVING_TO_CARD2);
+    armPhaseTimer(approachMs * 1000UL, true);
+    return;
+  }
 
   if (currentPosition != MIDDLE) {
-    Serial.println("[DualCard] Must be at middle position first - resetting");
+    LOG_INFO("DualCard", "Must be at middle position first - resetting");
     resetToMiddle();
     return;
   }
 
   // Card 2 = Retracted position from middle
-  Serial.println("[DualCard] Step 1: Retracting to Card 2 position...");
+  LOG_INFO("DualCard", "Step 1: Retracting to Card 2 position");
   retract();
   startDualCardOperation(MOVING_TO_CARD2);
+  armPhaseTimer(getCard2FromHomeMs() * 1000UL, true);  // Stop exactly at the card
+}
+
+// NEW: Pre-position near a card so the travel overlaps with test setup.
+// The actuator stops at the near point; the next tap of the same card only
+// performs the short final approach plus the dwell.
+void MotorController::prePosition(uint8_t card) {
+  if (currentOperation != IDLE) {
+    LOG_WARN("DualCard", "Cannot pre-position - operation in progress");
+    return;
+  }
+  if (card != 1 && card != 2) {
+    LOG_WARN("DualCard", "Invalid pre-position card: %u", card);
+    return;
+  }
+
+  if ((card == 1 && currentPosition == NEAR_CARD1) ||
+      (card == 2 && currentPosition == NEAR_CARD2)) {
+    LOG_INFO("DualCard", "Already pre-positioned near Card %u", card);
+    return;
+  }
+
+  if (currentPosition != MIDDLE) {
+    LOG_INFO("DualCard", "Must be at middle position first - resetting");
+    resetToMiddle();
+    return;
+  }
+
+  if (card == 1) {
+    LOG_INFO("DualCard", "Pre-positioning near Card 1: extending %lums", getCard1NearMs());
+    extend();
+    startDualCardOperation(MOVING_TO_CARD1);
+    armPhaseTimer(getCard1NearMs() * 1000UL, true);
+  } else {
+    LOG_INFO("DualCard", "Pre-positioning near Card 2: retracting %lums", getCard2NearMs());
+    retract();
+    startDualCardOperation(MOVING_TO_CARD2);
+    armPhaseTimer(getCard2NearMs() * 1000UL, true);
+  }
+  prePositionOnly = true;
 }
 
 void MotorController::updateDualCardOperations() {
+  // Closed-loop feedback (no-op on stock units without the sense hardware)
+  updateFeedbackSampling();
+
   if (currentOperation == IDLE) return;
 
   switch (currentOperation) {
@@ -310,92 +651,372 @@ void MotorController::updateDualCardOperations() {
       // Use exact timing based on where we came from
       if (previousPosition == CARD1) {
         // Moving from Card 1 (extended) to home
-        if (isDualCardOperationTimedOut(getCard1ToHomeMs())) {
+        if (consumePhaseTimer() || isDualCardOperationTimedOut(getCard1ToHomeMs())) {
           currentPosition = MIDDLE;
           completeDualCardOperation();
-          Serial.println("[DualCard] Reached home from Card 1");
+          LOG_INFO("DualCard", "Reached home from Card 1");
         }
       } else if (previousPosition == CARD2) {
         // Moving from Card 2 (retracted) to home
-        if (isDualCardOperationTimedOut(getCard2ToHomeMs())) {
+        if (consumePhaseTimer() || isDualCardOperationTimedOut(getCard2ToHomeMs())) {
           currentPosition = MIDDLE;
           completeDualCardOperation();
-          Serial.println("[DualCard] Reached home from Card 2");
+          LOG_INFO("DualCard", "Reached home from Card 2");
+        }
+      } else if (previousPosition == NEAR_CARD1) {
+        if (consumePhaseTimer() || isDualCardOperationTimedOut(getCard1ToHomeMs() * PRE_POSITION_TRAVEL_PCT / 100)) {
+          currentPosition = MIDDLE;
+          completeDualCardOperation();
+          LOG_INFO("DualCard", "Reached home from near Card 1");
+        }
+      } else if (previousPosition == NEAR_CARD2) {
+        if (consumePhaseTimer() || isDualCardOperationTimedOut(getCard2ToHomeMs() * PRE_POSITION_TRAVEL_PCT / 100)) {
+          currentPosition = MIDDLE;
+          completeDualCardOperation();
+          LOG_INFO("DualCard", "Reached home from near Card 2");
         }
       } else {
         // Unknown position - two-step process: full retract, then extend to middle
         if (previousPosition == UNKNOWN) {
-          // Step 1: Full retract (first time through)
-          if (isDualCardOperationTimedOut(getRetractFullMs())) {
-            Serial.println("[DualCard] Step 1 complete - fully retracted, now extending to middle");
+          // Step 1: Full retract (first time through; a retract limit
+          // switch, when fitted, ends the step as soon as it closes)
+          if (consumePhaseTimer() || feedbackArrivalDetected() || isDualCardOperationTimedOut(getRetractFullMs())) {
+            LOG_INFO("DualCard", "Step 1 complete - fully retracted, now extending to middle");
             extend();                               // Start extending to middle
             previousPosition = CARD2;               // Now we know we're at retracted position
             dualCardOperationStartTime = micros();  // Reset timer for extend phase
+            armPhaseTimer(getCard2ToHomeMs() * 1000UL, true);
           }
         } else {
           // Step 2: Extend from fully retracted to middle
-          if (isDualCardOperationTimedOut(getHomeFromRetractedMs())) {
+          if (consumePhaseTimer() || isDualCardOperationTimedOut(getHomeFromRetractedMs())) {
             currentPosition = MIDDLE;
             completeDualCardOperation();
-            Serial.println("[DualCard] Reached middle from unknown position (2-step process complete)");
+            LOG_INFO("DualCard", "Reached middle from unknown position (2-step process complete)");
           }
         }
       }
       break;
 
-    case MOVING_TO_CARD1:
-      if (isDualCardOperationTimedOut(getCard1FromHomeMs())) {
-        Serial.println("[DualCard] Reached Card 1, starting tap pause");
+    case MOVING_TO_CARD1: {
+      // Commanded travel depends on the leg: near point only, final
+      // approach from the near point, or the full run from middle
+      unsigned long expectedMs = prePositionOnly ? getCard1NearMs()
+                                 : (previousPosition == NEAR_CARD1)
+                                     ? getCard1FromHomeMs() - getCard1NearMs()
+                                     : getCard1FromHomeMs();
+      bool earlyArrival = feedbackArrivalDetected();
+      if (earlyArrival || consumePhaseTimer() || isDualCardOperationTimedOut(expectedMs)) {
+        if (prePositionOnly) {
+          prePositionOnly = false;
+          currentPosition = NEAR_CARD1;
+          LOG_INFO("DualCard", "Pre-positioned near Card 1");
+          completeDualCardOperation();
+          break;
+        }
+        if (earlyArrival && previousPosition == MIDDLE) {
+          // Measured travel vs commanded travel is a direct drift sample
+          // (only full runs from middle - partial legs would skew it)
+          learnDriftFromTravel(CARD1, safeElapsedMicros(dualCardOperationStartTime) / 1000, getCard1FromHomeMs());
+        }
+        LOG_INFO("DualCard", "Reached Card 1, starting tap pause");
         currentPosition = CARD1;
-        stop();  // Stop motor during tap pause
+        stop();  // GPIO already low from the timer/feedback path; updates state/status
         currentOperation = TAPPING_CARD1;
         dualCardOperationStartTime = micros();  // Reset timer for tap
+        armPhaseTimer(getCard1TapPauseMs() * 1000UL, false);  // Pause deadline
       }
       break;
+    }
 
-    case MOVING_TO_CARD2:
-      if (isDualCardOperationTimedOut(getCard2FromHomeMs())) {
-        Serial.println("[DualCard] Reached Card 2, starting tap pause");
+    case MOVING_TO_CARD2: {
+      unsigned long expectedMs = prePositionOnly ? getCard2NearMs()
+                                 : (previousPosition == NEAR_CARD2)
+                                     ? getCard2FromHomeMs() - getCard2NearMs()
+                                     : getCard2FromHomeMs();
+      bool earlyArrival = feedbackArrivalDetected();
+      if (earlyArrival || consumePhaseTimer() || isDualCardOperationTimedOut(expectedMs)) {
+        if (prePositionOnly) {
+          prePositionOnly = false;
+          currentPosition = NEAR_CARD2;
+          LOG_INFO("DualCard", "Pre-positioned near Card 2");
+          completeDualCardOperation();
+          break;
+        }
+        if (earlyArrival && previousPosition == MIDDLE) {
+          learnDriftFromTravel(CARD2, safeElapsedMicros(dualCardOperationStartTime) / 1000, getCard2FromHomeMs());
+        }
+        LOG_INFO("DualCard", "Reached Card 2, starting tap pause");
         currentPosition = CARD2;
-        stop();  // Stop motor during tap pause
+        stop();  // GPIO already low from the timer/feedback path; updates state/status
         currentOperation = TAPPING_CARD2;
         dualCardOperationStartTime = micros();  // Reset timer for tap
+        armPhaseTimer(getCard2TapPauseMs() * 1000UL, false);  // Pause deadline
       }
       break;
+    }
 
     case TAPPING_CARD1:
-      if (isDualCardOperationTimedOut(getCard1TapPauseMs())) {
+      if (consumePhaseTimer() || isDualCardOperationTimedOut(getCard1TapPauseMs())) {
         // Tap complete, return to home by retracting (opposite direction)
-        Serial.println("[DualCard] Card 1 tap complete, retracting " + String(getCard1ToHomeMs()) + "ms to home");
+        LOG_INFO("DualCard", "Card 1 tap complete, retracting %lums to home", getCard1ToHomeMs());
         retract();  // Card 1 is extended, so retract to return home
         previousPosition = CARD1;
         currentOperation = MOVING_TO_MIDDLE;
         dualCardOperationStartTime = micros();
+        armPhaseTimer(getCard1ToHomeMs() * 1000UL, true);
       }
       break;
 
     case TAPPING_CARD2:
-      if (isDualCardOperationTimedOut(getCard2TapPauseMs())) {
+      if (consumePhaseTimer() || isDualCardOperationTimedOut(getCard2TapPauseMs())) {
         // Tap complete, return to home by extending (opposite direction)
-        Serial.println("[DualCard] Card 2 tap complete, extending " + String(getCard2ToHomeMs()) + "ms to home");
+        LOG_INFO("DualCard", "Card 2 tap complete, extending %lums to home", getCard2ToHomeMs());
         extend();  // Card 2 is retracted, so extend to return home
         previousPosition = CARD2;
         currentOperation = MOVING_TO_MIDDLE;
         dualCardOperationStartTime = micros();
+        armPhaseTimer(getCard2ToHomeMs() * 1000UL, true);
       }
       break;
   }
 }
 
+// ============ NEW: BATCH TAP SEQUENCES ============
+
+bool MotorController::startSequence(const SequenceStep* steps, size_t stepCount) {
+  if (sequenceActive) {
+    LOG_WARN("Sequence", "Cannot start - sequence already running");
+    return false;
+  }
+  if (stepCount == 0 || stepCount > MAX_SEQUENCE_STEPS) {
+    LOG_WARN("Sequence", "Invalid step count: %u", (unsigned)stepCount);
+    return false;
+  }
+
+  memcpy(sequenceSteps, steps, stepCount * sizeof(SequenceStep));
+  sequenceStepCount = stepCount;
+  sequenceStepIndex = 0;
+  sequenceRepeatsDone = 0;
+  sequenceTapsCompleted = 0;
+  sequenceNextTapAt = millis();  // First tap fires immediately
+  sequenceTapInFlight = false;
+  sequenceActive = true;
+
+  LOG_INFO("Sequence", "Starting sequence with %u steps", (unsigned)stepCount);
+  mqttHandler.publishStatus("sequence_started");
+  return true;
+}
+
+void MotorController::updateSequence() {
+  if (!sequenceActive) return;
+
+  // Wait for the in-flight tap (or a position reset) to finish
+  if (sequenceTapInFlight) {
+    if (isTapping()) return;
+    sequenceTapInFlight = false;
+    sequenceTapsCompleted++;
+
+    // Inter-tap delay counts from tap completion - deterministic spacing
+    sequenceNextTapAt = millis() + sequenceSteps[sequenceStepIndex].interTapDelayMs;
+
+    sequenceRepeatsDone++;
+    if (sequenceRepeatsDone >= sequenceSteps[sequenceStepIndex].repeatCount) {
+      sequenceRepeatsDone = 0;
+      sequenceStepIndex++;
+    }
+
+    if (sequenceStepIndex >= sequenceStepCount) {
+      sequenceActive = false;
+      LOG_INFO("Sequence", "Complete - %lu taps", (unsigned long)sequenceTapsCompleted);
+      mqttHandler.publishStatus("sequence_complete");
+    }
+    return;
+  }
+
+  if (millis() < sequenceNextTapAt) return;
+  if (currentOperation != IDLE) return;  // e.g. a middle reset in progress
+
+  // Not at middle yet (first tap, or after manual interference) - reset
+  // first; the tap is issued on a later pass once we're home
+  if (currentPosition != MIDDLE) {
+    resetToMiddle();
+    return;
+  }
+
+  const SequenceStep& step = sequenceSteps[sequenceStepIndex];
+  if (step.card == 2) {
+    tapCard2();
+  } else {
+    tapCard1();
+  }
+  sequenceTapInFlight = true;
+}
+
+// ============ NEW: INTERVAL TAP SCHEDULER ============
+
+bool MotorController::startIntervalSchedule(uint8_t card, unsigned long intervalMs, uint32_t count, unsigned long jitterMs) {
+  if (scheduleActive || benchActive || sequenceActive || currentOperation != IDLE || isTapping()) {
+    LOG_WARN("Schedule", "Cannot start - device busy");
+    return false;
+  }
+  if (card < 1 || card > 2 || intervalMs == 0 || count == 0) {
+    LOG_WARN("Schedule", "Invalid parameters");
+    return false;
+  }
+
+  scheduleCard = card;
+  scheduleIntervalMs = intervalMs;
+  scheduleTapsRequested = count;
+  scheduleTapsDone = 0;
+  scheduleJitterMs = jitterMs;
+  scheduleStartMs = millis();
+  scheduleNextTapAt = scheduleStartMs;  // First tap fires immediately
+  if (scheduleJitterMs > 0) scheduleNextTapAt += random(scheduleJitterMs);
+  scheduleTapInFlight = false;
+  scheduleActive = true;
+
+  LOG_INFO("Schedule", "Card %u every %lums x%lu (jitter %lums)",
+           card, intervalMs, (unsigned long)count, jitterMs);
+  mqttHandler.publishStatus("schedule_started");
+  return true;
+}
+
+void MotorController::cancelIntervalSchedule() {
+  if (!scheduleActive) return;
+  scheduleActive = false;
+  scheduleTapInFlight = false;
+  LOG_INFO("Schedule", "Cancelled after %lu taps", (unsigned long)scheduleTapsDone);
+  mqttHandler.publishStatus("schedule_cancelled");
+}
+
+void MotorController::updateIntervalSchedule() {
+  if (!scheduleActive) return;
+
+  if (scheduleTapInFlight) {
+    if (isTapping() || currentOperation != IDLE) return;
+    scheduleTapInFlight = false;
+    scheduleTapsDone++;
+
+    if (scheduleTapsDone >= scheduleTapsRequested) {
+      scheduleActive = false;
+      LOG_INFO("Schedule", "Complete: %lu taps", (unsigned long)scheduleTapsDone);
+      mqttHandler.publishStatus("schedule_complete");
+      return;
+    }
+
+    // Deadlines derive from the anchor, not from when the last cycle
+    // finished - one slow tap does not push every later tap
+    scheduleNextTapAt = scheduleStartMs + scheduleTapsDone * scheduleIntervalMs;
+    if (scheduleJitterMs > 0) scheduleNextTapAt += random(scheduleJitterMs);
+  }
+
+  if ((long)(millis() - scheduleNextTapAt) < 0) return;
+  if (currentOperation != IDLE || isTapping()) return;
+
+  // Recover to middle first if something disturbed the position; the tap
+  // is issued on a later pass once we're home
+  if (currentPosition != MIDDLE) {
+    resetToMiddle();
+    return;
+  }
+
+  scheduleTapInFlight = true;
+  if (scheduleCard == 2) {
+    tapCard2();
+  } else {
+    tapCard1();
+  }
+}
+
+// ============ NEW: BENCHMARK MODE ============
+
+bool MotorController::startBench(uint32_t cycles, uint8_t card, unsigned long interCycleDelayMs) {
+  if (benchActive || scheduleActive || sequenceActive || currentOperation != IDLE || isTapping()) {
+    LOG_WARN("Bench", "Cannot start - device busy");
+    return false;
+  }
+  if (cycles == 0 || card > 2) {
+    LOG_WARN("Bench", "Invalid parameters");
+    return false;
+  }
+  if (currentPosition != MIDDLE) {
+    LOG_WARN("Bench", "Not at middle - run reset_to_middle or capture_middle first");
+    return false;
+  }
+
+  benchCyclesRequested = cycles;
+  benchCyclesDone = 0;
+  benchCard = card;
+  benchInterCycleDelayMs = interCycleDelayMs;
+  benchNextCycleAt = millis();  // First cycle fires immediately
+  benchTapInFlight = false;
+  benchActive = true;
+
+  if (card == 0) {
+    LOG_INFO("Bench", "Starting %lu cycles (alternating cards, %lums between cycles)",
+             (unsigned long)cycles, interCycleDelayMs);
+  } else {
+    LOG_INFO("Bench", "Starting %lu cycles (card %u, %lums between cycles)",
+             (unsigned long)cycles, card, interCycleDelayMs);
+  }
+  mqttHandler.publishStatus("bench_started");
+  return true;
+}
+
+void MotorController::updateBench() {
+  if (!benchActive) return;
+
+  if (benchTapInFlight) {
+    if (currentOperation != IDLE) return;  // Cycle still running
+
+    benchCycleUs[benchCyclesDone % BENCH_MAX_SAMPLES] = safeElapsedMicros(benchCycleStartUs);
+    benchCyclesDone++;
+    benchTapInFlight = false;
+    benchNextCycleAt = millis() + benchInterCycleDelayMs;
+
+    if (benchCyclesDone >= benchCyclesRequested) {
+      benchActive = false;
+      LOG_INFO("Bench", "Complete: %lu cycles - report at /api/bench", (unsigned long)benchCyclesDone);
+      mqttHandler.publishStatus("bench_complete");
+      return;
+    }
+  }
+
+  if ((long)(millis() - benchNextCycleAt) < 0) return;
+  if (currentOperation != IDLE || isTapping()) return;
+
+  // A failed cycle (emergency stop, stall) leaves us off-middle - recover
+  // without timing the recovery as a cycle
+  if (currentPosition != MIDDLE) {
+    resetToMiddle();
+    return;
+  }
+
+  uint8_t card = benchCard;
+  if (card == 0) card = (benchCyclesDone % 2 == 0) ? 1 : 2;
+  benchCycleStartUs = micros();
+  benchTapInFlight = true;
+  if (card == 2) {
+    tapCard2();
+  } else {
+    tapCard1();
+  }
+}
+
+size_t MotorController::getBenchSampleCount() const {
+  return (benchCyclesDone < BENCH_MAX_SAMPLES) ? benchCyclesDone : BENCH_MAX_SAMPLES;
+}
+
 // ============ NEW: CALIBRATION FUNCTIONS ============
 
 void MotorController::manualExtend() {
   if (currentOperation != IDLE) {
-    Serial.println("[Manual] Stopping current operation for manual control");
+    LOG_INFO("Manual", "Stopping current operation for manual control");
     completeDualCardOperation();
   }
 
-  Serial.println("[Manual] Manual extend started");
+  LOG_INFO("Manual", "Manual extend started");
   startTimingMeasurement();
   extend();
   currentPosition = UNKNOWN;  // Manual control invalidates position
@@ -404,11 +1025,11 @@ void MotorController::manualExtend() {
 
 void MotorController::manualRetract() {
   if (currentOperation != IDLE) {
-    Serial.println("[Manual] Stopping current operation for manual control");
+    LOG_INFO("Manual", "Stopping current operation for manual control");
     completeDualCardOperation();
   }
 
-  Serial.println("[Manual] Manual retract started");
+  LOG_INFO("Manual", "Manual retract started");
   startTimingMeasurement();
   retract();
   currentPosition = UNKNOWN;  // Manual control invalidates position
@@ -417,10 +1038,10 @@ void MotorController::manualRetract() {
 
 void MotorController::manualStop() {
   if (currentOperation != IDLE) {
-    Serial.println("[Manual] Stopping current operation");
+    LOG_INFO("Manual", "Stopping current operation");
     completeDualCardOperation();
   } else {
-    Serial.println("[Manual] Manual stop");
+    LOG_INFO("Manual", "Manual stop");
     stop();
   }
 
@@ -428,9 +1049,10 @@ void MotorController::manualStop() {
 
   // Capture timing measurement if active
   if (timingMeasurementActive) {
-    unsigned long elapsed = (micros() - manualTimingStart) / 1000;
-    Serial.println("[Timing] CAPTURED: " + String(elapsed) + "ms");
-    Serial.println("[Timing] Use this value in your timing constants");
+    lastMeasuredUs = micros() - manualTimingStart;
+    lastMeasuredFresh = true;
+    Serial.println("[Timing] CAPTURED: " + String(lastMeasuredUs / 1000) + "ms");
+    Serial.println("[Timing] Apply it to a calibration entry via POST /api/calibration");
     timingMeasurementActive = false;
   }
 }
@@ -441,8 +1063,13 @@ void MotorController::captureCurrentAsMiddle() {
     completeDualCardOperation();
   }
 
+  // Refine the adaptive drift estimate from this correction, then restart
+  // the accumulators from the re-trued position
+  learnDriftFromCapture();
+
   // Set current position as middle
   currentPosition = MIDDLE;
+  bumpStatusVersion();
   Serial.println("[Calibration] Current position captured as MIDDLE");
   Serial.println("[Calibration] You can now use tap functions from this position");
   mqttHandler.publishDetailedStatus();  // Enhanced: publish updated position status
@@ -467,31 +1094,35 @@ String MotorController::getTimingInfo() const {
 
 void MotorController::setPowerSource12V() {
   is12VPower = true;
+  bumpStatusVersion();
   Serial.println("[Power] Set to 12V external power - using fast measured timing");
 }
 
 void MotorController::setPowerSourceUSB() {
   is12VPower = false;
+  bumpStatusVersion();
   Serial.println("[Power] Set to USB power - using slow timing (2.3x multiplier)");
 }
 
 String MotorController::getPowerSourceString() const {
-  return is12VPower ? "12V" : "USB";
+  return String(getPowerSourceCString());
 }
 
 // ============ NEW: ENHANCED STATUS REPORTING ============
 
-String MotorController::getPositionString() const {
+const char* MotorController::getPositionCString() const {
   switch (currentPosition) {
     case UNKNOWN: return "unknown";
     case MIDDLE: return "middle";
     case CARD1: return "card1";
     case CARD2: return "card2";
+    case NEAR_CARD1: return "near_card1";
+    case NEAR_CARD2: return "near_card2";
     default: return "invalid";
   }
 }
 
-String MotorController::getOperationString() const {
+const char* MotorController::getOperationCString() const {
   switch (currentOperation) {
     case IDLE: return "idle";
     case MOVING_TO_MIDDLE: return "moving_to_middle";
@@ -504,6 +1135,18 @@ String MotorController::getOperationString() const {
   }
 }
 
+const char* MotorController::getPowerSourceCString() const {
+  return is12VPower ? "12V" : "USB";
+}
+
+String MotorController::getPositionString() const {
+  return String(getPositionCString());
+}
+
+String MotorController::getOperationString() const {
+  return String(getOperationCString());
+}
+
 // ============ NEW: TIMING HELPER FUNCTIONS ============
 
 unsigned long MotorController::safeElapsedMicros(unsigned long startTime) const {
@@ -513,81 +1156,146 @@ unsigned long MotorController::safeElapsedMicros(unsigned long startTime) const
 }
 
 unsigned long MotorController::getCard1FromHomeMs() const {
-  unsigned long baseTime = is12VPower ? CARD1_FROM_HOME_12V_US / 1000 : CARD1_FROM_HOME_USB_US / 1000;
-  return baseTime + card1DriftAccumulator;
+  unsigned long baseTime = is12VPower ? calibration.card1FromHome12vUs / 1000 : calibration.card1FromHomeUsbUs / 1000;
+  return baseTime + (int)lroundf(card1DriftAccumulatorMs);
 }
 
 unsigned long MotorController::getCard1TapPauseMs() const {
-  return is12VPower ? CARD1_TAP_PAUSE_12V_US / 1000 : CARD1_TAP_PAUSE_USB_US / 1000;
+  return is12VPower ? calibration.card1TapPause12vUs / 1000 : calibration.card1TapPauseUsbUs / 1000;
 }
 
 unsigned long MotorController::getCard1ToHomeMs() const {
-  return is12VPower ? CARD1_TO_HOME_12V_US / 1000 : CARD1_TO_HOME_USB_US / 1000;
+  return is12VPower ? calibration.card1ToHome12vUs / 1000 : calibration.card1ToHomeUsbUs / 1000;
 }
 
 unsigned long MotorController::getCard2FromHomeMs() const {
-  unsigned long baseTime = is12VPower ? CARD2_FROM_HOME_12V_US / 1000 : CARD2_FROM_HOME_USB_US / 1000;
-  return baseTime + card2DriftAccumulator;
+  unsigned long baseTime = is12VPower ? calibration.card2FromHome12vUs / 1000 : calibration.card2FromHomeUsbUs / 1000;
+  return baseTime + (int)lroundf(card2DriftAccumulatorMs);
 }
 
 unsigned long MotorController::getCard2TapPauseMs() const {
-  return is12VPower ? CARD2_TAP_PAUSE_12V_US / 1000 : CARD2_TAP_PAUSE_USB_US / 1000;
+  return is12VPower ? calibration.card2TapPause12vUs / 1000 : calibration.card2TapPauseUsbUs / 1000;
 }
 
 unsigned long MotorController::getCard2ToHomeMs() const {
-  return is12VPower ? CARD2_TO_HOME_12V_US / 1000 : CARD2_TO_HOME_USB_US / 1000;
+  return is12VPower ? calibration.card2ToHome12vUs / 1000 : calibration.card2ToHomeUsbUs / 1000;
 }
 
 unsigned long MotorController::getHomeFromExtendedMs() const {
-  return is12VPower ? HOME_FROM_EXTENDED_12V_US / 1000 : HOME_FROM_EXTENDED_USB_US / 1000;
+  return is12VPower ? calibration.homeFromExtended12vUs / 1000 : calibration.homeFromExtendedUsbUs / 1000;
 }
 
 unsigned long MotorController::getHomeFromRetractedMs() const {
-  return is12VPower ? HOME_FROM_RETRACTED_12V_US / 1000 : HOME_FROM_RETRACTED_USB_US / 1000;
+  return is12VPower ? calibration.homeFromRetracted12vUs / 1000 : calibration.homeFromRetractedUsbUs / 1000;
 }
 
 unsigned long MotorController::getExtendFullMs() const {
-  return is12VPower ? EXTEND_FULL_12V_US / 1000 : EXTEND_FULL_USB_US / 1000;
+  return is12VPower ? calibration.extendFull12vUs / 1000 : calibration.extendFullUsbUs / 1000;
 }
 
 unsigned long MotorController::getRetractFullMs() const {
-  return is12VPower ? RETRACT_FULL_12V_US / 1000 : RETRACT_FULL_USB_US / 1000;
+  return is12VPower ? calibration.retractFull12vUs / 1000 : calibration.retractFullUsbUs / 1000;
+}
+
+// NEW: Pre-positioning near points - a fixed fraction of the outbound leg
+unsigned long MotorController::getCard1NearMs() const {
+  return getCard1FromHomeMs() * PRE_POSITION_TRAVEL_PCT / 100;
+}
+
+unsigned long MotorController::getCard2NearMs() const {
+  return getCard2FromHomeMs() * PRE_POSITION_TRAVEL_PCT / 100;
 }
 
 // ============ NEW: INTERNAL DUAL CARD OPERATIONS ============
 
 void MotorController::startDualCardOperation(Operation op) {
-  Serial.println("[DualCard] Starting operation: " + getOperationString() + " at " + String(micros()) + "ms");
-  Serial.println("[DualCard] From position: " + getPositionString());
+  LOG_DEBUG("DualCard", "Starting operation from %s", getPositionCString());
 
   previousPosition = currentPosition;
   currentOperation = op;
   dualCardOperationStartTime = micros();
+  bumpStatusVersion();
 }
 
 void MotorController::completeDualCardOperation() {
-  unsigned long operationDuration = (micros() - dualCardOperationStartTime) / 1000;
-  Serial.println("[DualCard] Operation completed after " + String(operationDuration) + "ms");
-  Serial.println("[DualCard] Final position: " + getPositionString());
+  cancelPhaseTimer();  // Make sure an aborted operation leaves no armed timer
+  unsigned long operationDurationUs = micros() - dualCardOperationStartTime;
+  unsigned long operationDuration = operationDurationUs / 1000;
+  Metrics::recordTapCycle(operationDurationUs);
+  LOG_INFO("DualCard", "Operation completed after %lums (position %s)",
+           operationDuration, getPositionCString());
 
   // Update drift compensation after each tap cycle
   if (currentOperation == MOVING_TO_MIDDLE && previousPosition != UNKNOWN) {
     if (previousPosition == CARD1) {
-      card1DriftAccumulator -= DRIFT_PER_TAP_MS;
-      if (card1DriftAccumulator < -MAX_DRIFT_COMPENSATION) card1DriftAccumulator = -MAX_DRIFT_COMPENSATION;
-      Serial.println("[Drift] Card1 drift: " + String(card1DriftAccumulator) + "ms");
+      accumulateDrift(CARD1);
     } else if (previousPosition == CARD2) {
-      card2DriftAccumulator += DRIFT_PER_TAP_MS;
-      if (card2DriftAccumulator > MAX_DRIFT_COMPENSATION) card2DriftAccumulator = MAX_DRIFT_COMPENSATION;
-      Serial.println("[Drift] Card2 drift: " + String(card2DriftAccumulator) + "ms");
+      accumulateDrift(CARD2);
     }
   }
 
   stop();
   currentOperation = IDLE;
+  prePositionOnly = false;  // A manual stop mid-move must not leak the flag
+  bumpStatusVersion();
   mqttHandler.publishDetailedStatus();
 }
 
 bool MotorController::isDualCardOperationTimedOut(unsigned long timeoutMs) {
   return ((micros() - dualCardOperationStartTime) / 1000) >= timeoutMs;
+}
+
+// ============ NEW: ADAPTIVE DRIFT MODEL ============
+
+void MotorController::accumulateDrift(Position card) {
+  tapsSinceMiddleCapture++;
+  if (card == CARD1) {
+    card1DriftAccumulatorMs -= card1DriftPerTapMs;
+    if (card1DriftAccumulatorMs < -MAX_DRIFT_COMPENSATION) card1DriftAccumulatorMs = -MAX_DRIFT_COMPENSATION;
+    LOG_DEBUG("Drift", "Card1 drift: %.1fms (est %.2fms/tap)", card1DriftAccumulatorMs, card1DriftPerTapMs);
+  } else if (card == CARD2) {
+    card2DriftAccumulatorMs += card2DriftPerTapMs;
+    if (card2DriftAccumulatorMs > MAX_DRIFT_COMPENSATION) card2DriftAccumulatorMs = MAX_DRIFT_COMPENSATION;
+    LOG_DEBUG("Drift", "Card2 drift: %.1fms (est %.2fms/tap)", card2DriftAccumulatorMs, card2DriftPerTapMs);
+  }
+}
+
+void MotorController::learnDriftFromTravel(Position card, unsigned long actualMs, unsigned long commandedMs) {
+  // Feedback arrival before the timed deadline means the compensated travel
+  // time was still too long - the slack is a direct per-tap drift sample
+  if (actualMs >= commandedMs) return;
+  float sample = (float)(commandedMs - actualMs);
+  float& perTap = (card == CARD1) ? card1DriftPerTapMs : card2DriftPerTapMs;
+  perTap += DRIFT_LEARN_ALPHA * (sample - perTap);
+  if (perTap < 0.0f) perTap = 0.0f;
+  if (perTap > MAX_DRIFT_PER_TAP_MS) perTap = MAX_DRIFT_PER_TAP_MS;
+  LOG_INFO("Drift", "Travel sample %.1fms -> %s estimate %.2fms/tap",
+           sample, card == CARD1 ? "Card1" : "Card2", perTap);
+}
+
+void MotorController::learnDriftFromCapture() {
+  // The operator just re-trued the middle. If the corrective jog was
+  // measured (startTimingMeasurement + manual stop), its duration is the
+  // residual the model missed; spread it over the taps since the last
+  // capture. The jog direction is not recorded, so the residual only
+  // nudges the estimates upward - travel samples on feedback-equipped
+  // units pull them back down if the model over-corrects.
+  // Each measurement is folded in exactly once - re-applying the same
+  // stale residual on every capture would ratchet both estimates toward
+  // the clamp on units with no feedback to pull them back down
+  if (tapsSinceMiddleCapture > 0 && lastMeasuredFresh && lastMeasuredUs > 0) {
+    float residualPerTapMs = (lastMeasuredUs / 1000.0f) / tapsSinceMiddleCapture;
+    card1DriftPerTapMs += DRIFT_LEARN_ALPHA * residualPerTapMs;
+    card2DriftPerTapMs += DRIFT_LEARN_ALPHA * residualPerTapMs;
+    if (card1DriftPerTapMs > MAX_DRIFT_PER_TAP_MS) card1DriftPerTapMs = MAX_DRIFT_PER_TAP_MS;
+    if (card2DriftPerTapMs > MAX_DRIFT_PER_TAP_MS) card2DriftPerTapMs = MAX_DRIFT_PER_TAP_MS;
+    lastMeasuredFresh = false;
+    LOG_INFO("Drift", "Capture residual %.2fms/tap over %lu taps folded into estimates",
+             residualPerTapMs, (unsigned long)tapsSinceMiddleCapture);
+  }
+
+  // Either way the accumulators restart from a trusted zero
+  card1DriftAccumulatorMs = 0.0f;
+  card2DriftAccumulatorMs = 0.0f;
+  tapsSinceMiddleCapture = 0;
 }
\ No newline at end of file
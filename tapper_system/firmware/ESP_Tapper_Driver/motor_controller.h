@@ -3,6 +3,8 @@
 #define MOTOR_CONTROLLER_H
 
 #include <Arduino.h>
+#include "esp_timer.h"
+#include "calibration.h"
 
 class MotorController {
 public:
@@ -10,8 +12,10 @@ public:
   enum Position {
     UNKNOWN,
     MIDDLE,
-    CARD1,  // Extended position
-    CARD2   // Retracted position
+    CARD1,       // Extended position
+    CARD2,       // Retracted position
+    NEAR_CARD1,  // NEW: Pre-positioned short of Card 1 (most of the travel done)
+    NEAR_CARD2   // NEW: Pre-positioned short of Card 2
   };
 
   // Operation states for dual card support
@@ -29,6 +33,15 @@ public:
   void extend();
   void retract();
   void stop();
+
+  // NEW: Emergency lane (two-lane command design)
+  // emergencyStop() is called straight from transport handlers on the
+  // network core - it only de-energizes the GPIOs and raises a flag, so a
+  // jammed card stops pushing without waiting on the queue or JSON parsing.
+  // The motor task calls serviceEmergencyStop() each tick to do the state
+  // cleanup (abort operations, cancel timers, publish status).
+  void emergencyStop();
+  void serviceEmergencyStop();
   
   // Time-based operations (relay mimicking)
   void extendForTime(unsigned long duration_ms);
@@ -46,6 +59,61 @@ public:
   void tapCard1();
   void tapCard2();
   void updateDualCardOperations();  // Call in main loop
+
+  // NEW: Pre-positioning ("pre_position" action)
+  // Moves most of the way toward the target card while the harness is
+  // still reading the previous result, so the eventual tap_cardN only
+  // performs the short final approach plus the dwell - outbound travel
+  // overlaps reader processing instead of adding to per-test latency.
+  void prePosition(uint8_t card);
+
+  // NEW: Batch tap sequences (run_sequence action)
+  // A whole card1/card2 tap pattern executes from the internal state
+  // machine with one completion event, instead of one HTTP round trip
+  // per tap.
+  struct SequenceStep {
+    uint8_t card;                   // 1 or 2
+    uint16_t repeatCount;           // Taps for this step
+    unsigned long interTapDelayMs;  // Delay after each tap completes
+  };
+  static const size_t MAX_SEQUENCE_STEPS = 8;
+
+  bool startSequence(const SequenceStep* steps, size_t stepCount);
+  void updateSequence();  // Call in motor task
+  bool isSequenceActive() const { return sequenceActive; }
+
+  // NEW: Autonomous interval tap scheduler ("schedule" action)
+  // Endurance cadence ("tap card1 every 8s for 6 hours") runs from the
+  // motor task against deadlines anchored to the schedule start, so a
+  // slow cycle or network hiccup never breaks the rhythm and the ~10k
+  // HTTP round trips per run disappear. Progress rides
+  // /api/detailed_status; completion publishes over MQTT.
+  bool startIntervalSchedule(uint8_t card, unsigned long intervalMs, uint32_t count, unsigned long jitterMs);
+  void cancelIntervalSchedule();
+  void updateIntervalSchedule();  // Call in motor task
+  bool isIntervalScheduleActive() const { return scheduleActive; }
+  uint32_t getScheduleTapsDone() const { return scheduleTapsDone; }
+  uint32_t getScheduleTapsRequested() const { return scheduleTapsRequested; }
+
+  // NEW: Firmware-native benchmark mode (/api/bench)
+  // Runs N tap cycles from the motor task, reusing tapCard1()/tapCard2()
+  // and the dual-card state machine, and records each cycle duration
+  // microsecond-accurate into a RAM ring. The numbers come from the device
+  // itself, so network jitter never pollutes a regression measurement.
+  static const size_t BENCH_MAX_SAMPLES = 256;
+  bool startBench(uint32_t cycles, uint8_t card, unsigned long interCycleDelayMs);
+  void updateBench();  // Call in motor task
+  bool isBenchActive() const { return benchActive; }
+  uint32_t getBenchCyclesRequested() const { return benchCyclesRequested; }
+  uint32_t getBenchCyclesDone() const { return benchCyclesDone; }
+  size_t getBenchSampleCount() const;
+  const unsigned long* getBenchSamples() const { return benchCycleUs; }
+
+  // NEW: Drift model introspection (bench report / detailed status)
+  float getCard1DriftPerTap() const { return card1DriftPerTapMs; }
+  float getCard2DriftPerTap() const { return card2DriftPerTapMs; }
+  float getCard1DriftAccumulated() const { return card1DriftAccumulatorMs; }
+  float getCard2DriftAccumulated() const { return card2DriftAccumulatorMs; }
   
   // NEW: Calibration functions
   void manualExtend();
@@ -59,6 +127,17 @@ public:
   void setPowerSource12V();
   void setPowerSourceUSB();
   String getPowerSourceString() const;
+
+  // NEW: Per-device calibration table (NVS-backed, see calibration.h)
+  CalibrationTable& getCalibration() { return calibration; }
+  unsigned long getLastMeasuredUs() const { return lastMeasuredUs; }
+
+  // NEW: Optional closed-loop position feedback
+  // Units fitted with a current-sense shunt and/or limit switches (pins in
+  // motor_controller.cpp) terminate card moves on arrival detection instead
+  // of always running the full worst-case measured duration; timing stays
+  // as the fallback, and a stall mid-travel forces an emergency stop.
+  bool isFeedbackEnabled() const;
   
   // Enhanced status functions
   String getState() const;
@@ -68,6 +147,16 @@ public:
   String getOperationString() const;
   void checkLimitSwitches();  // Safety timeout only
 
+  // NEW: Change-based status invalidation
+  // The version bumps on every position/operation/power transition, so
+  // status consumers (HTTP cache, ETag generation) only rebuild their
+  // snapshot when something actually changed.
+  uint32_t getStatusVersion() const { return statusVersion; }
+  bool isTimingMeasurementActive() const { return timingMeasurementActive; }
+  const char* getPositionCString() const;     // Literal, allocation-free
+  const char* getOperationCString() const;    // Literal, allocation-free
+  const char* getPowerSourceCString() const;  // Literal, allocation-free
+
 private:
   enum State {
     STATE_IDLE,
@@ -104,44 +193,100 @@ private:
   Operation currentOperation = IDLE;
   unsigned long dualCardOperationStartTime = 0;
   
+  // NEW: Batch sequence state
+  SequenceStep sequenceSteps[MAX_SEQUENCE_STEPS];
+  size_t sequenceStepCount = 0;
+  size_t sequenceStepIndex = 0;
+  uint16_t sequenceRepeatsDone = 0;
+  unsigned long sequenceTapsCompleted = 0;
+  unsigned long sequenceNextTapAt = 0;  // millis() deadline for the next tap
+  bool sequenceActive = false;
+  bool sequenceTapInFlight = false;
+
+  // NEW: Interval schedule state
+  bool scheduleActive = false;
+  bool scheduleTapInFlight = false;
+  uint8_t scheduleCard = 1;
+  uint32_t scheduleTapsRequested = 0;
+  uint32_t scheduleTapsDone = 0;
+  unsigned long scheduleIntervalMs = 0;
+  unsigned long scheduleJitterMs = 0;
+  unsigned long scheduleStartMs = 0;    // Anchor for drift-free cadence
+  unsigned long scheduleNextTapAt = 0;  // millis() deadline for the next tap
+
+  // NEW: Benchmark state
+  bool benchActive = false;
+  bool benchTapInFlight = false;
+  uint32_t benchCyclesRequested = 0;
+  uint32_t benchCyclesDone = 0;
+  uint8_t benchCard = 0;  // 0 = alternate card1/card2
+  unsigned long benchInterCycleDelayMs = 0;
+  unsigned long benchNextCycleAt = 0;  // millis() deadline for the next cycle
+  unsigned long benchCycleStartUs = 0;
+  unsigned long benchCycleUs[BENCH_MAX_SAMPLES];
+
   // NEW: Manual timing measurement
   unsigned long manualTimingStart = 0;
   bool timingMeasurementActive = false;
   
   // NEW: Power source tracking
   bool is12VPower = true;  // Default to 12V
+
+  // NEW: Emergency lane flag (set on the network core, serviced on core 1)
+  volatile bool emergencyStopRequested = false;
+  volatile unsigned long emergencyStopAtUs = 0;  // micros() at de-energize
+
+  // NEW: Status snapshot versioning (bump also pushes an SSE status frame)
+  volatile uint32_t statusVersion = 1;
+  void bumpStatusVersion();
   
-  // NEW: Smart drift compensation
-  int card1DriftAccumulator = 0;  // Accumulated drift in ms for Card 1
-  int card2DriftAccumulator = 0;  // Accumulated drift in ms for Card 2
-  static const int DRIFT_PER_TAP_MS = 5;  // 5ms drift per tap cycle
+  // NEW: Adaptive drift model
+  // Replaces the fixed 5ms-per-tap constant, which over- or under-corrects
+  // depending on supply voltage, temperature, and actuator age. The per-tap
+  // estimate starts at the historical value and is refined from operator
+  // middle captures (residual error spread over the taps since the last
+  // capture) and, on feedback-equipped units, from measured outbound travel
+  // asymmetry. A better estimate stretches the interval between forced
+  // middle resets - fewer ~1.3s recalibrations, more taps per hour.
+  float card1DriftAccumulatorMs = 0.0f;  // Accumulated drift for Card 1
+  float card2DriftAccumulatorMs = 0.0f;  // Accumulated drift for Card 2
+  float card1DriftPerTapMs = 5.0f;       // Historical constant as prior
+  float card2DriftPerTapMs = 5.0f;
+  uint32_t tapsSinceMiddleCapture = 0;
   static const int MAX_DRIFT_COMPENSATION = 50;  // Max 50ms compensation
+  static constexpr float DRIFT_LEARN_ALPHA = 0.25f;  // EWMA weight per observation
+  static constexpr float MAX_DRIFT_PER_TAP_MS = 15.0f;
+  void accumulateDrift(Position card);
+  void learnDriftFromTravel(Position card, unsigned long actualMs, unsigned long commandedMs);
+  void learnDriftFromCapture();
   
-  // NEW: Measured timing constants (calibrated values) - MICROSECOND PRECISION
-  // 12V External Power (fast) - MEASURED VALUES in microseconds
-  static const unsigned long CARD1_FROM_HOME_12V_US = 1000000;    // Card 1 tap: extend to card (1000ms = 1,000,000μs)
-  static const unsigned long CARD1_TAP_PAUSE_12V_US = 100000;     // Card 1 tap: pause at card (100ms = 100,000μs)
-  static const unsigned long CARD1_TO_HOME_12V_US = 995000;       // Card 1 tap: return to home (995ms = 995,000μs, 5ms drift compensation)
-  static const unsigned long CARD2_FROM_HOME_12V_US = 1400000;    // Card 2 tap: retract to card (1400ms = 1,400,000μs)
-  static const unsigned long CARD2_TAP_PAUSE_12V_US = 100000;     // Card 2 tap: pause at card (100ms = 100,000μs)
-  static const unsigned long CARD2_TO_HOME_12V_US = 1395000;      // Card 2 tap: return to home (1395ms = 1,395,000μs, 5ms drift compensation)
-  static const unsigned long HOME_FROM_EXTENDED_12V_US = 1306000; // MEASURED: middle from extended (1306ms = 1,306,000μs)
-  static const unsigned long HOME_FROM_RETRACTED_12V_US = 1284000; // MEASURED: middle from retracted (1284ms = 1,284,000μs)
-  static const unsigned long EXTEND_FULL_12V_US = 2568000;        // MEASURED: full extend travel time (2568ms = 2,568,000μs)
-  static const unsigned long RETRACT_FULL_12V_US = 2611000;       // MEASURED: full retract travel time (2611ms = 2,611,000μs)
-  
-  // USB Power (slow) - Calculated from 12V measurements with 2.3x multiplier in microseconds
-  static const unsigned long CARD1_FROM_HOME_USB_US = 2530000;    // 2530ms = 2,530,000μs (1100 * 2.3)
-  static const unsigned long CARD1_TAP_PAUSE_USB_US = 1000000;    // 1000ms = 1,000,000μs (same pause time)
-  static const unsigned long CARD1_TO_HOME_USB_US = 2530000;      // 2530ms = 2,530,000μs (balanced timing)
-  static const unsigned long CARD2_FROM_HOME_USB_US = 2990000;    // 2990ms = 2,990,000μs (1300 * 2.3)
-  static const unsigned long CARD2_TAP_PAUSE_USB_US = 1000000;    // 1000ms = 1,000,000μs (same pause time)
-  static const unsigned long CARD2_TO_HOME_USB_US = 2990000;      // 2990ms = 2,990,000μs (balanced timing)
-  static const unsigned long HOME_FROM_EXTENDED_USB_US = 3004000; // 3004ms = 3,004,000μs (1306 * 2.3)
-  static const unsigned long HOME_FROM_RETRACTED_USB_US = 2953000; // 2953ms = 2,953,000μs (1284 * 2.3)
-  static const unsigned long EXTEND_FULL_USB_US = 5906000;        // 5906ms = 5,906,000μs (2568 * 2.3)
-  static const unsigned long RETRACT_FULL_USB_US = 6005000;       // 6005ms = 6,005,000μs (2611 * 2.3)
-  
+  // NEW: Measured movement timings now live in the NVS-backed calibration
+  // table (calibration.h) so a worn unit can be retimed without reflashing.
+  // Defaults are the same measured microsecond values as before.
+  CalibrationTable calibration;
+
+  // NEW: Last manual timing measurement (feeds /api/calibration updates).
+  // The fresh flag marks a capture the drift model has not consumed yet;
+  // without it every capture_middle would re-fold the same stale residual.
+  unsigned long lastMeasuredUs = 0;
+  bool lastMeasuredFresh = false;
+
+  // NEW: Closed-loop feedback state
+  void updateFeedbackSampling();    // ADC sampling + stall detection
+  bool feedbackArrivalDetected();   // Arrival at a card (early termination)
+  float motorCurrentEwma = 0.0f;    // Smoothed current-sense reading
+  unsigned long lastFeedbackSampleUs = 0;
+  bool feedbackArrivalLatched = false;
+
+
+  // NEW: Pre-positioning state
+  // The near point sits at a fixed fraction of the full outbound travel;
+  // the remainder is the "final approach" a tap from NEAR_CARDx performs
+  static const uint8_t PRE_POSITION_TRAVEL_PCT = 70;
+  bool prePositionOnly = false;  // Current card move stops at the near point
+  unsigned long getCard1NearMs() const;
+  unsigned long getCard2NearMs() const;
+
   // NEW: Timing helper functions with overflow protection
   unsigned long safeElapsedMicros(unsigned long startTime) const;
   unsigned long getCard1FromHomeMs() const;
@@ -159,6 +304,25 @@ private:
   void startDualCardOperation(Operation op);
   void completeDualCardOperation();
   bool isDualCardOperationTimedOut(unsigned long timeoutMs);
+
+  // NEW: Hardware timer stops (esp_timer one-shots)
+  // The GPIO stop for timed and dual card movements fires from an esp_timer
+  // callback with microsecond accuracy, so positioning no longer depends on
+  // how long server.handleClient() or client.loop() keep the main loop busy.
+  // The loop update functions only do the follow-up bookkeeping.
+  esp_timer_handle_t timedOpTimer = nullptr;   // extendForTime/retractForTime stop
+  esp_timer_handle_t phaseTimer = nullptr;     // Dual card phase deadlines
+  volatile bool timedOpTimerFired = false;
+  volatile bool phaseTimerFired = false;
+  bool phaseStopsMotor = false;  // Should the phase timer de-energize on fire?
+
+  static void onTimedOpTimer(void* arg);
+  static void onPhaseTimer(void* arg);
+  void armTimedOpTimer(unsigned long delayUs);
+  void armPhaseTimer(unsigned long delayUs, bool stopMotorOnFire);
+  void cancelTimedOpTimer();
+  void cancelPhaseTimer();
+  bool consumePhaseTimer();  // Timer fired OR polled fallback deadline passed
 };
 
 #endif
\ No newline at end of file
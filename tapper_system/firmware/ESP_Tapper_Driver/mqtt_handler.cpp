@@ -1,9 +1,16 @@
 // mqtt_handler.cpp - ENHANCED FOR DUAL CARD OPERATIONS
 #include "mqtt_handler.h"
 #include "motor_controller.h"  // Include for detailed status access
+#include "command_router.h"    // Emergency lane classifier
+#include "command_queue.h"
+#include "heap_monitor.h"
+#include "logger.h"
 #include "wifi_config.h"
 #include <PubSubClient.h>
 
+extern CommandQueue commandQueue;
+extern uint8_t assignedStationId;  // Station assignment (http_server.cpp)
+
 MQTTHandler* MQTTHandler::instance = nullptr;
 
 MQTTHandler::MQTTHandler(CommandRouter& router)
@@ -18,6 +25,10 @@ void MQTTHandler::init() {
   // Set aggressive timeouts to prevent blocking
   client.setSocketTimeout(1);      // 1 second socket timeout
   client.setKeepAlive(5);          // 5 second keepalive
+
+  // Default PubSubClient buffer is 256 bytes - too small for a full
+  // run_sequence payload (the queue slots hold 1KB, see command_queue.h)
+  client.setBufferSize(1280);
   
   // Set the callback for incoming messages
   client.setCallback(callback);
@@ -27,23 +38,35 @@ void MQTTHandler::init() {
   statusTopic = "tappers/" + deviceId + "/status";
   Serial.println("[MQTT] Status topic: " + statusTopic);
 
+  // Mirror drained log lines to the log topic when connected
+  logTopic = "tappers/" + deviceId + "/log";
+  Logger::setSink(publishLogLine);
+
   // Try initial connection
   tryConnection();
 }
 
 void MQTTHandler::loop() {
   unsigned long now = millis();
-  
+
+  // Event-driven recovery: a WiFi up-transition skips the backoff window
+  // so broker reconnect rides right behind interface recovery
+  bool wifiUp = WiFiConfig::isConnected();
+  if (wifiUp && !wasWifiConnected) {
+    lastReconnectAttempt = 0;
+    reconnectBackoffMs = RECONNECT_BACKOFF_MIN_MS;
+  }
+  wasWifiConnected = wifiUp;
+
   if (!client.connected()) {
-    // Only try reconnecting every 15 seconds after failures
-    if (now - lastReconnectAttempt > (connectionFailed ? 15000 : 5000)) {
+    if (wifiUp && now - lastReconnectAttempt > reconnectBackoffMs) {
       lastReconnectAttempt = now;
       tryConnection();
     }
   } else {
-    // Connected - process MQTT messages
+    // Connected - process MQTT messages and flush pending status events
     client.loop();
-    connectionFailed = false;  // Reset failure flag
+    drainStatusQueue();
   }
 }
 
@@ -53,50 +76,170 @@ void MQTTHandler::tryConnection() {
   String topic = "tappers/" + deviceId + "/command";
 
   Serial.print("[MQTT] Quick connection attempt...");
-  
-  // The key fix: This connect() call will now fail fast (1-2 seconds max)
-  bool connected = client.connect(clientId.c_str());
-  
+
+  // clean_session=false: the broker holds our QoS 1 subscriptions and any
+  // commands published during an outage, and replays them on reconnect -
+  // nothing vanishes because we were away for a few seconds
+  // Last will on the birth topic: if the session dies uncleanly (power
+  // cut, WiFi drop), the broker replaces the retained birth with this
+  // retained offline marker - a dead tapper never stays "discovered"
+  String birthTopic = "tappers/" + deviceId + "/birth";
+  char will[96];
+  snprintf(will, sizeof(will), "{\"device_id\":\"%s\",\"status\":\"offline\"}", deviceId.c_str());
+
+  bool connected = client.connect(clientId.c_str(), nullptr, nullptr,
+                                  birthTopic.c_str(), 1, true, will, false);
+
   if (connected) {
     Serial.println(" SUCCESS!");
-    client.subscribe(topic.c_str());
+    reconnectBackoffMs = RECONNECT_BACKOFF_MIN_MS;
+
+    client.subscribe(topic.c_str(), 1);  // QoS 1 - queued while offline
     Serial.println("[MQTT] Subscribed to: " + topic);
-    connectionFailed = false;
-    
+
+    // Binary frame lane - producers opt in by publishing to /command/bin
+    String binTopic = topic + "/bin";
+    client.subscribe(binTopic.c_str(), 1);
+    Serial.println("[MQTT] Subscribed to: " + binTopic);
+
+    // Shared group topic for fleet-synchronized commands; the router
+    // filters by "stations" and honors "execute_at" timestamps
+    client.subscribe("tappers/group/command", 1);
+    Serial.println("[MQTT] Subscribed to: tappers/group/command");
+
+    // Retained birth message - orchestrators discover the fleet from the
+    // broker the moment they subscribe, instead of scanning the subnet
+    // (the LWT above overwrites it with the offline marker on a dirty exit)
+    char birth[160];
+    snprintf(birth, sizeof(birth),
+             "{\"device_id\":\"%s\",\"ip\":\"%s\",\"station_id\":%u,\"status\":\"online\"}",
+             deviceId.c_str(), WiFi.localIP().toString().c_str(), assignedStationId);
+    client.publish(birthTopic.c_str(), birth, true);
+
     // Publish initial status
     publishStatus("idle");
   } else {
     Serial.print(" FAILED (rc=");
     Serial.print(client.state());
     Serial.println(") - HTTP server remains responsive");
-    connectionFailed = true;
+
+    // Exponential backoff with jitter so a bounced broker is not hammered
+    // in lockstep by the whole fleet
+    reconnectBackoffMs *= 2;
+    if (reconnectBackoffMs > RECONNECT_BACKOFF_MAX_MS) {
+      reconnectBackoffMs = RECONNECT_BACKOFF_MAX_MS;
+    }
+    reconnectBackoffMs += random(RECONNECT_JITTER_MS);
   }
 }
 
-void MQTTHandler::publishStatus(String status) {
-  if (client.connected()) {
-    bool success = client.publish(statusTopic.c_str(), status.c_str());
-    if (success) {
-      Serial.println("[MQTT] Published status: " + status);
+void MQTTHandler::publishStatus(const char* status) {
+  // Append-only from the caller's point of view - the actual socket write
+  // happens in drainStatusQueue() on the network task
+  enqueueStatus(status, false);
+}
+
+void MQTTHandler::publishStatus(const String& status) {
+  publishStatus(status.c_str());
+}
+
+void MQTTHandler::enqueueStatus(const char* text, bool detailed) {
+  taskENTER_CRITICAL(&statusQueueMux);
+
+  // Coalesce: a newer state supersedes a pending one of the same kind
+  // that nobody has drained yet
+  if (statusHead != statusTail) {
+    size_t lastSlot = (statusTail + STATUS_QUEUE_CAPACITY - 1) & (STATUS_QUEUE_CAPACITY - 1);
+    if (statusQueue[lastSlot].detailed == detailed) {
+      strncpy(statusQueue[lastSlot].text, text, MAX_STATUS_LENGTH - 1);
+      statusQueue[lastSlot].text[MAX_STATUS_LENGTH - 1] = '\0';
+      taskEXIT_CRITICAL(&statusQueueMux);
+      return;
+    }
+  }
+
+  size_t nextTail = (statusTail + 1) & (STATUS_QUEUE_CAPACITY - 1);
+  if (nextTail == statusHead) {
+    // Full - drop the oldest entry; the latest state is what matters
+    statusHead = (statusHead + 1) & (STATUS_QUEUE_CAPACITY - 1);
+  }
+  strncpy(statusQueue[statusTail].text, text, MAX_STATUS_LENGTH - 1);
+  statusQueue[statusTail].text[MAX_STATUS_LENGTH - 1] = '\0';
+  statusQueue[statusTail].detailed = detailed;
+  statusTail = nextTail;
+
+  taskEXIT_CRITICAL(&statusQueueMux);
+}
+
+void MQTTHandler::drainStatusQueue() {
+  while (statusHead != statusTail) {
+    StatusEvent event;
+    taskENTER_CRITICAL(&statusQueueMux);
+    event = statusQueue[statusHead];
+    statusHead = (statusHead + 1) & (STATUS_QUEUE_CAPACITY - 1);
+    taskEXIT_CRITICAL(&statusQueueMux);
+
+    if (event.detailed) {
+      // Built at drain time so the snapshot reflects the freshest state
+      if (!motorController) continue;
+      char detailed[192];
+      snprintf(detailed, sizeof(detailed), "Position: %s, Operation: %s, Power: %s, Heap: %u free / %u min",
+               motorController->getPositionCString(),
+               motorController->getOperationCString(),
+               motorController->getPowerSourceCString(),
+               HeapMonitor::getFreeHeap(),
+               HeapMonitor::getMinFreeHeap());
+      if (!client.publish(statusTopic.c_str(), detailed)) {
+        Serial.println("[MQTT] Failed to publish detailed status");
+      }
     } else {
-      Serial.println("[MQTT] Failed to publish status: " + status);
+      if (!client.publish(statusTopic.c_str(), event.text)) {
+        Serial.print("[MQTT] Failed to publish status: ");
+        Serial.println(event.text);
+      }
     }
-  } else {
-    Serial.println("[MQTT] Cannot publish status - not connected");
   }
 }
 
-void MQTTHandler::callback(char* topic, byte* payload, unsigned int length) {
-  String message;
-  for (unsigned int i = 0; i < length; i++) {
-    message += (char)payload[i];
+void MQTTHandler::publishLogLine(const char* line) {
+  if (instance && instance->client.connected()) {
+    instance->client.publish(instance->logTopic.c_str(), line);
   }
+}
 
-  Serial.println("[MQTT] Received on " + String(topic) + ": " + message);
+void MQTTHandler::callback(char* topic, byte* payload, unsigned int length) {
+  // Buffered - the old synchronous payload echo cost milliseconds of UART
+  // time before the command was even queued
+  LOG_DEBUG("MQTT", "Received %u bytes on %s", length, topic);
 
-  if (instance) {
-    instance->commandRouter.handleJsonCommand(message);
+  // Binary frames (the /command/bin topic) are queued as-is - the magic
+  // byte routes them past the JSON parser on the motor task. A binary
+  // stop still takes the emergency lane.
+  if (length == sizeof(CommandRouter::BinaryCommandFrame) &&
+      payload[0] == CommandRouter::BINARY_FRAME_MAGIC) {
+    if (payload[1] == CommandRouter::BIN_OP_STOP) {
+      if (instance && instance->motorController) {
+        instance->motorController->emergencyStop();
+      }
+      return;
+    }
+    commandQueue.enqueue(reinterpret_cast<const char*>(payload), length);
+    return;
   }
+
+  // Emergency lane: stop/manual_stop de-energize right here, ahead of
+  // anything sitting in the queue
+  if (CommandRouter::isEmergencyStop(reinterpret_cast<const char*>(payload), length)) {
+    if (instance && instance->motorController) {
+      instance->motorController->emergencyStop();
+    }
+    return;
+  }
+
+  // Enqueue the payload bytes PubSubClient already holds - one memcpy into
+  // a pre-allocated queue slot, zero heap allocation between packet arrival
+  // and motor dispatch. The motor task parses the JSON in place.
+  commandQueue.enqueue(reinterpret_cast<const char*>(payload), length);
 }
 
 // ============ NEW: ENHANCED DUAL CARD STATUS FUNCTIONS ============
@@ -107,25 +250,7 @@ void MQTTHandler::setMotorController(MotorController* controller) {
 }
 
 void MQTTHandler::publishDetailedStatus() {
-  if (!client.connected() || !motorController) {
-    return;
-  }
-  
-  // Create detailed status string with dual card information
-  String detailedStatus = "Position: " + motorController->getPositionString() + 
-                         ", Operation: " + motorController->getOperationString() + 
-                         ", Power: " + motorController->getPowerSourceString();
-  
-  // Add timing info if measurement is active
-  String timingInfo = motorController->getTimingInfo();
-  if (timingInfo != "No timing measurement active") {
-    detailedStatus += ", " + timingInfo;
-  }
-  
-  bool success = client.publish(statusTopic.c_str(), detailedStatus.c_str());
-  if (success) {
-    Serial.println("[MQTT] Published detailed status: " + detailedStatus);
-  } else {
-    Serial.println("[MQTT] Failed to publish detailed status");
-  }
+  // Enqueue a marker; the snapshot text is rendered at drain time on the
+  // network task so the motor path does no string building at all
+  enqueueStatus("", true);
 }
\ No newline at end of file
@@ -12,23 +12,53 @@ public:
   MQTTHandler(CommandRouter& router);
   void init();
   void loop();
-  void publishStatus(String status);  // Basic status publishing
-  void publishDetailedStatus();       // Enhanced dual card status
+  // NEW: Status publishing is queue-based. The motor code appends a
+  // fixed-size entry and returns immediately; the network task drains the
+  // ring when the socket is available, coalescing superseded states, so
+  // motor GPIO transitions never wait on a slow broker.
+  void publishStatus(const char* status);     // Basic status publishing
+  void publishStatus(const String& status);   // Convenience overload
+  void publishDetailedStatus();               // Enhanced dual card status
   void setMotorController(MotorController* controller);  // Set motor controller reference
 
 private:
   void tryConnection();  // Non-blocking connection attempt
+  void drainStatusQueue();
   static void callback(char* topic, byte* payload, unsigned int length);  // Must be static
 
+  // NEW: Outbound status ring buffer (allocation-free, fixed-size entries).
+  // Also the offline buffer: the ring keeps filling while the broker is
+  // away (coalescing superseded states, dropping oldest when full) and
+  // drains in order on reconnect. Sized to ride out a typical broker blip.
+  static const size_t STATUS_QUEUE_CAPACITY = 32;  // Must be a power of two
+  static const size_t MAX_STATUS_LENGTH = 32;
+  struct StatusEvent {
+    char text[MAX_STATUS_LENGTH];
+    bool detailed;  // Detailed snapshots are built at drain time from live state
+  };
+  StatusEvent statusQueue[STATUS_QUEUE_CAPACITY];
+  portMUX_TYPE statusQueueMux = portMUX_INITIALIZER_UNLOCKED;
+  volatile size_t statusHead = 0;
+  volatile size_t statusTail = 0;
+  void enqueueStatus(const char* text, bool detailed);
+
   WiFiClient espClient;
   PubSubClient client;
   CommandRouter& commandRouter;
   MotorController* motorController;  // Reference to motor controller for detailed status
   static MQTTHandler* instance;      // for static callback
 
+  // NEW: Reconnect with exponential backoff + jitter instead of a fixed
+  // 15s poll; a WiFi up-transition forces an immediate attempt, so broker
+  // recovery is bounded by seconds, not by the polling interval
   unsigned long lastReconnectAttempt = 0;
-  bool connectionFailed = false;   // Track if last connection failed
-  static const unsigned long reconnectInterval = 5000;
+  unsigned long reconnectBackoffMs = RECONNECT_BACKOFF_MIN_MS;
+  bool wasWifiConnected = false;
+  static const unsigned long RECONNECT_BACKOFF_MIN_MS = 500;
+  static const unsigned long RECONNECT_BACKOFF_MAX_MS = 30000;
+  static const unsigned long RECONNECT_JITTER_MS = 250;
 
   String statusTopic;  // Status topic for publishing
+  String logTopic;     // Buffered logger mirror (see logger.h)
+  static void publishLogLine(const char* line);  // Logger sink
 };
\ No newline at end of file
@@ -0,0 +1,233 @@
+#include "ota_updater.h"
+#include "motor_controller.h"
+#include "watchdog.h"
+#include "logger.h"
+#include <Update.h>
+#include <HTTPClient.h>
+#include <esp_ota_ops.h>
+
+extern MotorController motorController;
+
+namespace OtaUpdater {
+
+// Shared fleet token, sent as X-OTA-Token on uploads and as "token" in
+// the MQTT pull command. Change per deployment; it keeps a stray POST on
+// the lab network from reflashing a tapper, not more than that.
+static const char* OTA_TOKEN = "tapper-fleet-ota";
+
+// A new image must run this long without a crash/watchdog reset before
+// it is marked valid; an earlier death rolls back to the old partition
+static const unsigned long CONFIRM_STABLE_MS = 30000;
+
+// Pull download buffer - sized to keep HTTPClient reads off the heap
+static const size_t PULL_CHUNK_BYTES = 1024;
+
+static bool active = false;
+static bool rebootPending = false;
+static unsigned long rebootNotBeforeMs = 0;
+static const char* lastError = nullptr;
+
+static bool pullRequested = false;
+static char pullUrl[160];
+
+static bool imageConfirmed = false;
+
+// The idle gate: no dual-card operation, sequence, schedule, or bench
+// may be running. Flash writes stall the flash cache briefly and the
+// reboot kills everything, so updates only proceed on a quiet actuator.
+static bool motorIsQuiet() {
+  return motorController.getCurrentOperation() == MotorController::IDLE &&
+         !motorController.isSequenceActive() &&
+         !motorController.isIntervalScheduleActive() &&
+         !motorController.isBenchActive();
+}
+
+bool isActive() {
+  return active;
+}
+
+const char* getLastError() {
+  return lastError;
+}
+
+bool beginUpload(size_t totalSize, const char* token) {
+  lastError = nullptr;
+
+  if (token == nullptr || strcmp(token, OTA_TOKEN) != 0) {
+    lastError = "Bad or missing OTA token";
+    return false;
+  }
+  if (active || rebootPending) {
+    lastError = "Update already in progress";
+    return false;
+  }
+  if (!motorIsQuiet()) {
+    lastError = "Motor busy - update refused";
+    return false;
+  }
+  if (totalSize == 0) {
+    lastError = "Empty image";
+    return false;
+  }
+
+  if (!Update.begin(totalSize)) {
+    lastError = Update.errorString();
+    LOG_ERROR("OTA", "Update.begin failed: %s", lastError);
+    return false;
+  }
+
+  active = true;
+  LOG_INFO("OTA", "Upload started: %u bytes", (unsigned)totalSize);
+  return true;
+}
+
+bool writeChunk(const uint8_t* data, size_t len) {
+  if (!active) return false;
+
+  if (Update.write(const_cast<uint8_t*>(data), len) != len) {
+    lastError = Update.errorString();
+    LOG_ERROR("OTA", "Flash write failed: %s", lastError);
+    Update.abort();
+    active = false;
+    return false;
+  }
+  return true;
+}
+
+bool finishUpload() {
+  if (!active) return false;
+  active = false;
+
+  if (!Update.end(true)) {
+    lastError = Update.errorString();
+    LOG_ERROR("OTA", "Update.end failed: %s", lastError);
+    return false;
+  }
+
+  // Give the HTTP response time to flush before the idle-gated reboot
+  rebootPending = true;
+  rebootNotBeforeMs = millis() + 1000;
+  LOG_INFO("OTA", "Image written - rebooting when motor is idle");
+  return true;
+}
+
+bool requestPull(const char* url, const char* token) {
+  if (token == nullptr || strcmp(token, OTA_TOKEN) != 0) {
+    LOG_WARN("OTA", "Pull refused: bad or missing token");
+    return false;
+  }
+  if (url == nullptr || strlen(url) == 0 || strlen(url) >= sizeof(pullUrl)) {
+    LOG_WARN("OTA", "Pull refused: bad URL");
+    return false;
+  }
+  if (active || rebootPending || pullRequested) {
+    LOG_WARN("OTA", "Pull refused: update already in progress");
+    return false;
+  }
+
+  strncpy(pullUrl, url, sizeof(pullUrl) - 1);
+  pullUrl[sizeof(pullUrl) - 1] = '\0';
+  pullRequested = true;
+  LOG_INFO("OTA", "Pull queued: %s", pullUrl);
+  return true;
+}
+
+// Runs in the network task; blocks it for the duration of the download,
+// which is fine - the motor task is on the other core and the task
+// watchdog is fed per chunk.
+static void performPull() {
+  if (!motorIsQuiet()) {
+    // Stay queued; retried on the next update() once the actuator is quiet
+    return;
+  }
+  pullRequested = false;
+
+  HTTPClient http;
+  if (!http.begin(pullUrl)) {
+    LOG_ERROR("OTA", "Pull failed: bad URL");
+    return;
+  }
+
+  int code = http.GET();
+  if (code != HTTP_CODE_OK) {
+    LOG_ERROR("OTA", "Pull failed: HTTP %d", code);
+    http.end();
+    return;
+  }
+
+  int total = http.getSize();
+  if (total <= 0) {
+    LOG_ERROR("OTA", "Pull failed: no Content-Length");
+    http.end();
+    return;
+  }
+
+  if (!Update.begin((size_t)total)) {
+    LOG_ERROR("OTA", "Update.begin failed: %s", Update.errorString());
+    http.end();
+    return;
+  }
+
+  LOG_INFO("OTA", "Pulling %d bytes from %s", total, pullUrl);
+  active = true;
+
+  WiFiClient* stream = http.getStreamPtr();
+  uint8_t chunk[PULL_CHUNK_BYTES];
+  size_t written = 0;
+  while (written < (size_t)total && http.connected()) {
+    size_t avail = stream->available();
+    if (avail == 0) {
+      delay(1);
+      continue;
+    }
+    if (avail > sizeof(chunk)) avail = sizeof(chunk);
+    int got = stream->readBytes(chunk, avail);
+    if (got <= 0) break;
+    if (Update.write(chunk, got) != (size_t)got) {
+      LOG_ERROR("OTA", "Flash write failed: %s", Update.errorString());
+      Update.abort();
+      active = false;
+      http.end();
+      return;
+    }
+    written += got;
+    // This loop owns the network task for the whole download - keep the
+    // task watchdog fed so a slow transfer does not read as a stall
+    Watchdog::beat(Watchdog::CP_MQTT);
+  }
+  http.end();
+  active = false;
+
+  if (written != (size_t)total || !Update.end(true)) {
+    LOG_ERROR("OTA", "Pull incomplete (%u/%d): %s", (unsigned)written, total, Update.errorString());
+    if (!Update.isFinished()) Update.abort();
+    return;
+  }
+
+  rebootPending = true;
+  rebootNotBeforeMs = millis() + 1000;
+  LOG_INFO("OTA", "Image pulled - rebooting when motor is idle");
+}
+
+void update() {
+  // A freshly flashed image runs in a rollback-pending state until it
+  // proves itself; crashing before this point boots the old partition
+  if (!imageConfirmed && millis() > CONFIRM_STABLE_MS) {
+    imageConfirmed = true;
+    esp_ota_mark_app_valid_cancel_rollback();
+    Serial.println("[OTA] Running image confirmed valid (stable startup)");
+  }
+
+  if (pullRequested) {
+    performPull();
+  }
+
+  if (rebootPending && millis() > rebootNotBeforeMs && motorIsQuiet()) {
+    Serial.println("[OTA] Rebooting into new firmware...");
+    Serial.flush();
+    delay(100);
+    ESP.restart();
+  }
+}
+
+}  // namespace OtaUpdater
@@ -0,0 +1,39 @@
+// ota_updater.h - Over-the-air firmware updates
+// Two delivery paths into the inactive OTA app partition: a streamed
+// upload through POST /api/ota (fleet tooling pushes in parallel) and an
+// MQTT-triggered pull, where the device fetches the image from a URL on
+// the lab network. Both are gated on the motor being fully idle - an
+// in-flight tap is never interrupted by flash writes or the reboot - and
+// both require the shared OTA token. The new image boots from the other
+// partition and is only marked valid after a stable startup window, so a
+// firmware that crashes on boot rolls back instead of bricking a tapper.
+#ifndef OTA_UPDATER_H
+#define OTA_UPDATER_H
+
+#include <Arduino.h>
+
+namespace OtaUpdater {
+  // An update session (upload or pull) is in progress.
+  bool isActive();
+
+  // HTTP upload session, driven by the /api/ota body callback.
+  // beginUpload checks the token and the idle gate; on refusal
+  // getLastError() says why. finishUpload schedules the idle-gated
+  // reboot into the new image.
+  bool beginUpload(size_t totalSize, const char* token);
+  bool writeChunk(const uint8_t* data, size_t len);
+  bool finishUpload();
+  const char* getLastError();  // nullptr while the session is healthy
+
+  // MQTT-triggered pull: stores the URL; the download itself runs from
+  // the network task on the next update() so the motor task and the MQTT
+  // callback stay unblocked.
+  bool requestPull(const char* url, const char* token);
+
+  // Called periodically from the network task: performs a requested
+  // pull, confirms a freshly booted image once it has proven stable,
+  // and reboots into a completed update when the motor goes idle.
+  void update();
+}
+
+#endif
@@ -0,0 +1,142 @@
+#include "watchdog.h"
+#include "motor_controller.h"
+#include "logger.h"
+#include <esp_task_wdt.h>
+
+extern MotorController motorController;
+
+namespace Watchdog {
+
+// Chip reset when a subscribed task stops beating for this long
+static const uint32_t WDT_TIMEOUT_S = 10;
+// Hardware failsafe threshold for the 1ms motor tick. Generous next to the
+// tick so a burst of SSE pushes cannot trip it, but far below any motor
+// timing window - the longest calibrated travel leg is seconds
+static const uint32_t MOTOR_DEADLINE_MS = 200;
+
+// Checkpoint snapshot kept in RTC slow memory: survives task-watchdog and
+// panic resets (not power loss), so init() can read back what each
+// subsystem was doing right before the crash
+struct CrashRecord {
+  uint32_t magic;
+  uint32_t beatMs[CP_COUNT];   // millis() of each checkpoint's last beat
+  char operation[20];          // Motor operation at the last motor beat
+};
+static const uint32_t RECORD_MAGIC = 0x57444F47;  // "WDOG"
+
+RTC_NOINIT_ATTR static CrashRecord record;
+
+// Recovered post-reset report (empty unless the last reset was a crash)
+static bool haveCrashReport = false;
+static const char* crashResetReason = "";
+static uint32_t crashAgeMs[CP_COUNT];
+static char crashOperation[20];
+
+static bool failsafeTripped = false;
+
+static const char* checkpointName(uint8_t cp) {
+  switch (cp) {
+    case CP_MOTOR: return "motor";
+    case CP_MQTT: return "mqtt";
+    case CP_HTTP: return "http";
+    default: return "invalid";
+  }
+}
+
+void init() {
+  esp_reset_reason_t reason = esp_reset_reason();
+  bool crashed = (reason == ESP_RST_TASK_WDT || reason == ESP_RST_INT_WDT ||
+                  reason == ESP_RST_WDT || reason == ESP_RST_PANIC);
+
+  if (crashed && record.magic == RECORD_MAGIC) {
+    // Ages are measured against the freshest beat - that is as close to
+    // "the moment of death" as the snapshot gets. The stalest supervised
+    // checkpoint is the one that starved the watchdog.
+    uint32_t newest = 0;
+    for (uint8_t cp = 0; cp < CP_COUNT; cp++) {
+      if (record.beatMs[cp] > newest) newest = record.beatMs[cp];
+    }
+    for (uint8_t cp = 0; cp < CP_COUNT; cp++) {
+      crashAgeMs[cp] = newest - record.beatMs[cp];
+    }
+    strncpy(crashOperation, record.operation, sizeof(crashOperation) - 1);
+    crashOperation[sizeof(crashOperation) - 1] = '\0';
+    crashResetReason = (reason == ESP_RST_PANIC) ? "panic" : "task_wdt";
+    haveCrashReport = true;
+
+    uint8_t stalled = (crashAgeMs[CP_MOTOR] >= crashAgeMs[CP_MQTT]) ? CP_MOTOR : CP_MQTT;
+    Serial.println("[Watchdog] Previous reset: " + String(crashResetReason) +
+                   ", stalled checkpoint: " + String(checkpointName(stalled)) +
+                   " (age " + String(crashAgeMs[stalled]) + "ms) during " + String(crashOperation));
+  }
+
+  // Restart the snapshot for this boot
+  record.magic = RECORD_MAGIC;
+  for (uint8_t cp = 0; cp < CP_COUNT; cp++) {
+    record.beatMs[cp] = millis();
+  }
+  strncpy(record.operation, "idle", sizeof(record.operation));
+
+  // panic=true: a starved task takes the chip down (and into the report
+  // above) instead of wedging silently with the motor possibly energized
+  esp_task_wdt_init(WDT_TIMEOUT_S, true);
+  Serial.println("[Watchdog] Task watchdog armed: " + String(WDT_TIMEOUT_S) +
+                 "s timeout, motor deadline " + String(MOTOR_DEADLINE_MS) + "ms");
+}
+
+void supervise(TaskHandle_t task) {
+  esp_task_wdt_add(task);
+}
+
+void beat(Checkpoint cp) {
+  record.beatMs[cp] = millis();
+  // No-op (ESP_ERR_NOT_FOUND) from tasks that are not subscribed, like
+  // the async HTTP server's handler task
+  esp_task_wdt_reset();
+}
+
+void noteOperation(const char* operation) {
+  if (strncmp(record.operation, operation, sizeof(record.operation)) == 0) return;
+  strncpy(record.operation, operation, sizeof(record.operation) - 1);
+  record.operation[sizeof(record.operation) - 1] = '\0';
+}
+
+void update() {
+  // Hardware failsafe: the motor task is wedged past its deadline, so its
+  // own state machine cannot stop the actuator. De-energize from this
+  // core through the same lane the emergency stop uses - the GPIOs go low
+  // immediately; the state cleanup runs if/when the motor task recovers
+  uint32_t age = millis() - record.beatMs[CP_MOTOR];
+  if (age > MOTOR_DEADLINE_MS) {
+    if (!failsafeTripped) {
+      failsafeTripped = true;
+      LOG_ERROR("Watchdog", "Motor task missed deadline (%lums) - de-energizing outputs",
+                (unsigned long)age);
+      motorController.emergencyStop();
+    }
+  } else {
+    failsafeTripped = false;
+  }
+}
+
+void toJson(JsonDocument& doc) {
+  JsonObject watchdog = doc.createNestedObject("watchdog");
+  uint32_t now = millis();
+  watchdog["motor_age_ms"] = now - record.beatMs[CP_MOTOR];
+  watchdog["mqtt_age_ms"] = now - record.beatMs[CP_MQTT];
+  watchdog["http_age_ms"] = now - record.beatMs[CP_HTTP];
+  watchdog["failsafe_tripped"] = failsafeTripped;
+
+  if (haveCrashReport) {
+    JsonObject crash = watchdog.createNestedObject("last_crash");
+    crash["reset_reason"] = crashResetReason;
+    uint8_t stalled = (crashAgeMs[CP_MOTOR] >= crashAgeMs[CP_MQTT]) ? CP_MOTOR : CP_MQTT;
+    crash["stalled"] = checkpointName(stalled);
+    crash["motor_age_ms"] = crashAgeMs[CP_MOTOR];
+    crash["mqtt_age_ms"] = crashAgeMs[CP_MQTT];
+    crash["http_age_ms"] = crashAgeMs[CP_HTTP];
+    crash["operation"] = crashOperation;
+  }
+}
+
+}  // namespace Watchdog
@@ -0,0 +1,55 @@
+// watchdog.h - Task watchdog supervision with stall attribution
+// Both pinned tasks are subscribed to the ESP32 task watchdog, and each
+// subsystem stamps a heartbeat checkpoint as it runs. A monitor on the
+// network core de-energizes the motor GPIOs if the motor task misses its
+// update deadline (the hardware failsafe - a wedged motor task must never
+// leave the actuator driving past its timing window), and after a
+// watchdog/panic reset the checkpoint ages at the moment of the crash are
+// recovered from RTC memory so /api/detailed_status can say which
+// subsystem stalled instead of just "it rebooted".
+#ifndef WATCHDOG_H
+#define WATCHDOG_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+namespace Watchdog {
+  // Heartbeat checkpoints. MOTOR and MQTT cover the two supervised tasks;
+  // HTTP covers the async server's handler task, which is not watchdog-
+  // subscribed (we do not own its loop) but whose heartbeat age makes a
+  // wedged server visible from the MQTT side.
+  enum Checkpoint : uint8_t {
+    CP_MOTOR = 0,
+    CP_MQTT,
+    CP_HTTP,
+    CP_COUNT
+  };
+
+  // Configures the task watchdog and, after a watchdog/panic reset,
+  // recovers the pre-crash checkpoint snapshot from RTC memory.
+  // Call once from setup() before the tasks start.
+  void init();
+
+  // Subscribes a pinned task to the task watchdog. A subscribed task that
+  // stops beating for WDT_TIMEOUT_S resets the chip.
+  void supervise(TaskHandle_t task);
+
+  // Heartbeat: stamps the checkpoint and feeds the task watchdog when the
+  // calling task is subscribed. Cheap enough for the 1ms motor tick.
+  void beat(Checkpoint cp);
+
+  // Records the motor operation active right now, so a post-reset report
+  // can name what the actuator was doing when the firmware died.
+  void noteOperation(const char* operation);
+
+  // Called periodically from the network task; trips the hardware
+  // failsafe when the motor heartbeat goes stale.
+  void update();
+
+  // Fills a "watchdog" object (live checkpoint ages, failsafe state, and
+  // the last crash report if any) into the given document - used by
+  // /api/detailed_status.
+  void toJson(JsonDocument& doc);
+}
+
+#endif
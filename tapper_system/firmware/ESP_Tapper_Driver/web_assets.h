@@ -0,0 +1,252 @@
+// web_assets.h - Compressed control UI assets stored in flash
+// Generated from the fallback index page: gzip -9 the HTML and dump the
+// bytes below. Served with Content-Encoding: gzip so the multi-kilobyte
+// page never has to exist uncompressed in RAM.
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <pgmspace.h>
+
+const size_t INDEX_HTML_GZ_LEN = 3795;
+const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xed, 0x5c, 0x5b, 0x6f, 0xdb, 0xc8,
+  0x15, 0x7e, 0xcf, 0xaf, 0x98, 0x6a, 0x91, 0x52, 0x6a, 0x4d, 0x59, 0x94, 0x2d, 0xdf, 0x62, 0xbb,
+  0xdb, 0x24, 0x5e, 0x34, 0x40, 0x82, 0x04, 0x6b, 0xa7, 0xe8, 0xa2, 0x28, 0x8c, 0x11, 0x39, 0x94,
+  0x66, 0x4d, 0x91, 0x04, 0x49, 0x59, 0xf6, 0x66, 0x17, 0xe8, 0x4b, 0xb7, 0x0f, 0xdd, 0x36, 0xd8,
+  0xee, 0x02, 0xed, 0x76, 0x5b, 0xa4, 0x7d, 0xea, 0x4b, 0x81, 0x62, 0xd1, 0x97, 0xf6, 0xef, 0xe4,
+  0x0f, 0x34, 0x3f, 0xa1, 0x67, 0x2e, 0x94, 0xc8, 0xe1, 0x0c, 0x29, 0x5f, 0x9b, 0x62, 0xeb, 0xc4,
+  0xb6, 0xc4, 0xb9, 0x9d, 0x39, 0xe7, 0x3b, 0xd7, 0x19, 0x79, 0xf7, 0x3b, 0x0f, 0x9f, 0x3e, 0x38,
+  0xfa, 0xe0, 0xd9, 0x01, 0x1a, 0x67, 0x93, 0x60, 0xff, 0xce, 0x2e, 0xfb, 0x85, 0x02, 0x1c, 0x8e,
+  0xf6, 0x5a, 0x24, 0x6c, 0xb1, 0x07, 0x04, 0x7b, 0xfb, 0x77, 0x10, 0x7c, 0xed, 0x4e, 0x48, 0x86,
+  0x91, 0x3b, 0xc6, 0x49, 0x4a, 0xb2, 0xbd, 0xd6, 0xf3, 0xa3, 0xf7, 0xec, 0xad, 0x56, 0xb1, 0x29,
+  0xc4, 0x13, 0xb2, 0xd7, 0x3a, 0xa5, 0x64, 0x16, 0x47, 0x49, 0xd6, 0x42, 0x6e, 0x14, 0x66, 0x24,
+  0x84, 0xae, 0x33, 0xea, 0x65, 0xe3, 0x3d, 0x8f, 0x9c, 0x52, 0x97, 0xd8, 0xfc, 0xcd, 0x0a, 0xa2,
+  0x21, 0xcd, 0x28, 0x0e, 0xec, 0xd4, 0xc5, 0x01, 0xd9, 0x73, 0xba, 0xbd, 0x7c, 0xaa, 0x8c, 0x66,
+  0x01, 0xd9, 0x3f, 0x38, 0x7c, 0xb6, 0xd6, 0x47, 0x0f, 0xa7, 0x38, 0x40, 0x0f, 0x70, 0xe2, 0xa1,
+  0x23, 0x1c, 0xc7, 0x24, 0x41, 0x0f, 0x60, 0xca, 0x24, 0x0a, 0x76, 0x57, 0x45, 0x2f, 0x31, 0x22,
+  0xcd, 0xce, 0xf3, 0xd7, 0xec, 0x6b, 0x27, 0x89, 0xa2, 0x0c, 0xbd, 0x98, 0xbf, 0x67, 0x5f, 0xb6,
+  0x1d, 0x27, 0x74, 0x82, 0x93, 0xf3, 0x1d, 0xf4, 0xce, 0xc6, 0xda, 0xc6, 0x86, 0xef, 0xdc, 0xd3,
+  0xb7, 0xdb, 0xe3, 0xe8, 0x94, 0x24, 0xd0, 0x6b, 0xdd, 0x5f, 0xdf, 0x20, 0x03, 0xb5, 0x57, 0x3a,
+  0x75, 0x5d, 0x92, 0xa6, 0xd0, 0xee, 0xf4, 0x86, 0xdb, 0x5b, 0x8e, 0xa1, 0x7d, 0x3e, 0x4b, 0x6f,
+  0xb0, 0xbd, 0xb1, 0xb1, 0xad, 0xf6, 0x9a, 0xe1, 0x24, 0xa4, 0xe1, 0x08, 0xda, 0xfd, 0xc1, 0x36,
+  0xe9, 0x0d, 0x0d, 0xed, 0xf3, 0x59, 0xbc, 0xed, 0xcd, 0xcd, 0xde, 0x86, 0xda, 0xcb, 0x03, 0x29,
+  0xf1, 0x66, 0xe2, 0xaf, 0xc3, 0x97, 0xbe, 0x79, 0x31, 0x87, 0xdb, 0xdf, 0xe8, 0x57, 0xe6, 0x18,
+  0x8e, 0x0a, 0x8c, 0xf1, 0xf9, 0x97, 0xa6, 0x4b, 0x4a, 0x40, 0x94, 0x9e, 0xec, 0xb4, 0xe5, 0x63,
+  0xdf, 0xd5, 0x74, 0xca, 0x48, 0x02, 0x02, 0x15, 0x7d, 0x1c, 0x7f, 0xe0, 0x57, 0x76, 0x9d, 0x91,
+  0xb3, 0xac, 0xb0, 0x9a, 0x43, 0xfa, 0xdb, 0x6b, 0x43, 0x6d, 0xa7, 0xe2, 0x7a, 0x1b, 0xeb, 0x9b,
+  0xeb, 0x5b, 0x95, 0x6e, 0xc3, 0x28, 0xf1, 0xc4, 0xde, 0xfb, 0x64, 0xcb, 0xef, 0x55, 0xc4, 0x30,
+  0xc6, 0x5e, 0x34, 0xdb, 0x41, 0x3d, 0xb4, 0x1e, 0x9f, 0xa1, 0x0d, 0xf8, 0xb6, 0x1d, 0xf8, 0x91,
+  0x8c, 0x86, 0xb8, 0xdd, 0x5b, 0x41, 0xf2, 0x7f, 0xd7, 0xe9, 0xe8, 0x07, 0xda, 0xc1, 0x88, 0x8d,
+  0x75, 0x7a, 0x30, 0xc6, 0x19, 0xb0, 0xd1, 0x6b, 0x0d, 0xa3, 0x3f, 0xb9, 0x33, 0x7f, 0xf9, 0x53,
+  0x0f, 0x67, 0xd8, 0xce, 0xc6, 0x84, 0x29, 0x03, 0x6c, 0xe2, 0xa4, 0xf5, 0xb3, 0x1a, 0x30, 0x6e,
+  0x39, 0x5b, 0xae, 0xbf, 0xd5, 0x04, 0x46, 0x3d, 0x64, 0x17, 0x60, 0x5c, 0x5b, 0xf7, 0xd6, 0xb6,
+  0xb7, 0x9b, 0xc0, 0xa8, 0x87, 0x6c, 0x01, 0x8c, 0xc3, 0xa1, 0xdf, 0x5f, 0x6f, 0x02, 0xa3, 0x1e,
+  0xb2, 0x73, 0x30, 0xfa, 0x5b, 0x9b, 0xce, 0xa6, 0xd3, 0x00, 0x46, 0x3d, 0x62, 0x4b, 0x60, 0xd4,
+  0xc3, 0x43, 0x01, 0xe3, 0xda, 0xda, 0xba, 0x33, 0x18, 0xd4, 0x83, 0x71, 0x7d, 0x73, 0x30, 0xd8,
+  0x68, 0x02, 0xa3, 0x1e, 0xd5, 0x15, 0x30, 0xba, 0x43, 0x6f, 0x40, 0x1c, 0x23, 0x18, 0xd5, 0xa5,
+  0x0a, 0xa8, 0xf8, 0x9e, 0x82, 0x81, 0x61, 0x74, 0x66, 0xa7, 0xf4, 0x23, 0xce, 0x78, 0x31, 0x1e,
+  0xa6, 0x39, 0x2b, 0xcf, 0x0c, 0xb4, 0x8d, 0x68, 0x08, 0x48, 0x2c, 0x3f, 0x8e, 0xb1, 0xe7, 0xf1,
+  0x71, 0x3d, 0xed, 0x4a, 0xc3, 0xc8, 0x3b, 0x57, 0x16, 0xf3, 0xc1, 0x6a, 0xda, 0x3e, 0x9e, 0xd0,
+  0x00, 0x36, 0x61, 0x3d, 0x02, 0xab, 0x9c, 0x58, 0x2b, 0xc8, 0x06, 0x93, 0x1a, 0x10, 0x3b, 0x3d,
+  0x4f, 0x33, 0x32, 0x59, 0x41, 0xf7, 0x03, 0x1a, 0x9e, 0x3c, 0xc1, 0xee, 0x21, 0x7f, 0xff, 0x1e,
+  0x0c, 0x59, 0x41, 0xd6, 0x21, 0x19, 0x45, 0x04, 0x3d, 0x7f, 0x04, 0xdd, 0xdf, 0x8f, 0x86, 0x51,
+  0x16, 0xad, 0xa0, 0x14, 0x87, 0x29, 0x30, 0x25, 0xa1, 0x8a, 0xa5, 0x80, 0xe1, 0xc4, 0x1e, 0x13,
+  0x3a, 0x1a, 0x67, 0x3b, 0xc8, 0xe9, 0x2a, 0xa6, 0xc6, 0x8d, 0x82, 0x08, 0x58, 0x74, 0x8a, 0x93,
+  0x76, 0x99, 0xf9, 0x8a, 0x0a, 0x0e, 0xb1, 0x7b, 0x32, 0x4a, 0xa2, 0x69, 0xe8, 0xed, 0xf0, 0x19,
+  0x71, 0x62, 0x8f, 0x12, 0xec, 0x51, 0xf0, 0x23, 0x6d, 0x67, 0x6d, 0xe0, 0x91, 0xd1, 0x8a, 0x9c,
+  0xa4, 0x08, 0x85, 0x0e, 0xea, 0xdd, 0x2d, 0x3c, 0xcf, 0xa5, 0xdf, 0x01, 0x15, 0xee, 0xdd, 0x55,
+  0x56, 0x98, 0xd0, 0x70, 0x41, 0x66, 0xaf, 0x77, 0x3a, 0x2e, 0x37, 0x67, 0x09, 0xec, 0x0f, 0x5c,
+  0x53, 0x04, 0x8c, 0xc7, 0x41, 0x00, 0x7a, 0xbe, 0x96, 0x22, 0x82, 0x53, 0xa2, 0x65, 0x76, 0x97,
+  0xf9, 0x38, 0x0c, 0x74, 0x26, 0x0a, 0xcb, 0x27, 0xf8, 0x4c, 0x78, 0x3a, 0x58, 0xa4, 0xdf, 0x03,
+  0x43, 0x62, 0x10, 0x2d, 0xc2, 0xd3, 0x2c, 0x32, 0xc8, 0xb7, 0x9f, 0x90, 0x89, 0x99, 0x3b, 0xf3,
+  0xdd, 0x1a, 0x18, 0x29, 0x40, 0xc5, 0x78, 0x37, 0x05, 0x13, 0xd1, 0xaf, 0x90, 0xc0, 0x11, 0x28,
+  0xed, 0xa4, 0x98, 0x6b, 0x6e, 0xfc, 0x3a, 0x7a, 0x62, 0x19, 0x3d, 0x1a, 0x7a, 0x19, 0x51, 0x5e,
+  0x12, 0xc5, 0xb6, 0x4f, 0x83, 0x8c, 0xe9, 0xc1, 0x30, 0x98, 0x26, 0x6d, 0x66, 0x3c, 0x3b, 0x57,
+  0x62, 0x2d, 0x8b, 0x3c, 0x2a, 0x7c, 0xf5, 0x68, 0x1a, 0x07, 0x18, 0x60, 0xec, 0x07, 0x44, 0xd9,
+  0xd0, 0x87, 0xd3, 0x34, 0xa3, 0xfe, 0xb9, 0x2d, 0xc3, 0x8e, 0x1d, 0x94, 0xc6, 0x18, 0xe2, 0x8d,
+  0x21, 0xc9, 0x66, 0x84, 0x84, 0xe5, 0xbe, 0x38, 0xa0, 0xa3, 0xd0, 0xa6, 0x00, 0x74, 0xe0, 0x8d,
+  0x4b, 0x98, 0x46, 0xe8, 0xf6, 0x0c, 0x3a, 0x99, 0x65, 0xd1, 0x44, 0x27, 0x0a, 0x29, 0xa5, 0x79,
+  0x0f, 0xa7, 0x2a, 0xac, 0x5c, 0xad, 0xe5, 0x14, 0xe0, 0x42, 0xd2, 0x28, 0xa0, 0x5e, 0x2e, 0x39,
+  0xde, 0xac, 0xf7, 0x21, 0x5d, 0x1e, 0xde, 0xe8, 0xb4, 0x18, 0x6c, 0x06, 0x81, 0xb9, 0xba, 0x83,
+  0xca, 0x72, 0xbc, 0x79, 0x26, 0x81, 0xbd, 0xd5, 0xeb, 0x5d, 0x56, 0xaf, 0x72, 0x38, 0x15, 0x54,
+  0x4a, 0x3a, 0x12, 0xad, 0x3a, 0xc1, 0x92, 0xc3, 0x13, 0x9a, 0xd9, 0x8b, 0x05, 0x6c, 0x37, 0xa0,
+  0xf1, 0x0e, 0x62, 0x4a, 0xae, 0xef, 0xca, 0xd5, 0x1f, 0xc0, 0x12, 0xd8, 0xd2, 0x2a, 0x70, 0x60,
+  0xc4, 0x38, 0x01, 0x62, 0x4c, 0x54, 0x6b, 0x27, 0x2d, 0x71, 0x8c, 0x39, 0x5c, 0x3b, 0x8b, 0x46,
+  0xa3, 0x0a, 0xe3, 0xb4, 0x5a, 0xb3, 0xb0, 0x1d, 0x3a, 0xa9, 0x2d, 0x21, 0x2e, 0x8d, 0x92, 0x0d,
+  0x2a, 0x4a, 0xb6, 0xb0, 0xd5, 0x1a, 0x89, 0xb9, 0xd3, 0x24, 0x65, 0xdb, 0x8f, 0x23, 0x5a, 0x05,
+  0xe0, 0x12, 0xca, 0xd2, 0xa0, 0x0f, 0x8d, 0x18, 0x1f, 0xe1, 0xb8, 0x4a, 0x98, 0x89, 0xa7, 0x3b,
+  0xdc, 0x77, 0x2b, 0x9c, 0xe5, 0x44, 0xfa, 0x51, 0x32, 0x91, 0x32, 0x0c, 0x70, 0x46, 0x3e, 0x68,
+  0xdb, 0xfd, 0x8a, 0xea, 0x9b, 0x8c, 0x8d, 0x01, 0xfe, 0x69, 0x86, 0xb3, 0x69, 0x6a, 0xbb, 0x2c,
+  0xf2, 0x7f, 0x71, 0x3b, 0x38, 0x96, 0x50, 0x9c, 0x8d, 0x81, 0x61, 0x06, 0x19, 0x3a, 0x1a, 0x19,
+  0x2a, 0x08, 0x60, 0xd1, 0xe2, 0x05, 0x0d, 0xc9, 0x12, 0xac, 0xe1, 0x54, 0x44, 0x39, 0x1a, 0x12,
+  0x02, 0x6c, 0xa6, 0xa7, 0x0a, 0x95, 0x4c, 0x3a, 0x7e, 0xc0, 0x26, 0x19, 0x53, 0xcf, 0x2b, 0xda,
+  0x3b, 0x03, 0x63, 0x77, 0x76, 0x86, 0x04, 0x44, 0xa7, 0x2a, 0xcb, 0xdc, 0x7a, 0x5a, 0x96, 0x89,
+  0x00, 0x3c, 0x04, 0xc5, 0x98, 0xaa, 0x6c, 0xca, 0xa2, 0xb8, 0x12, 0xaa, 0x04, 0xc4, 0xcf, 0x2a,
+  0x0f, 0x13, 0x61, 0xa2, 0x54, 0x03, 0x25, 0x19, 0x74, 0x01, 0xbb, 0xb5, 0x2e, 0xc4, 0x5d, 0xb0,
+  0x1e, 0x68, 0x8d, 0x09, 0x9b, 0x07, 0xea, 0xfd, 0xc1, 0x60, 0x25, 0xff, 0x66, 0xb1, 0x3a, 0x28,
+  0xe7, 0xdd, 0x72, 0xdf, 0xcd, 0x0a, 0x06, 0x70, 0x08, 0x90, 0x11, 0x7b, 0x4c, 0xc7, 0x74, 0x32,
+  0x01, 0xbc, 0x83, 0xd2, 0xd1, 0xd0, 0x67, 0xc9, 0xaa, 0xde, 0x4b, 0xbd, 0x7b, 0x42, 0xce, 0xfd,
+  0x04, 0x12, 0xdf, 0x74, 0x3e, 0xa4, 0xcc, 0xcf, 0xde, 0x5d, 0xf4, 0x42, 0xab, 0x27, 0x3f, 0x69,
+  0xdb, 0x02, 0x86, 0x30, 0x5d, 0x71, 0x00, 0x7b, 0x68, 0x1c, 0x52, 0x19, 0xa1, 0x11, 0xee, 0x28,
+  0xa1, 0x9e, 0xc9, 0x6b, 0xb2, 0x36, 0xc5, 0x08, 0xc0, 0x13, 0xb0, 0xc8, 0x93, 0x98, 0x2d, 0xc0,
+  0x0c, 0xf2, 0x74, 0x12, 0xa6, 0x0c, 0x64, 0x31, 0xc1, 0x59, 0x9b, 0x79, 0x7b, 0x30, 0xd5, 0x10,
+  0x0a, 0x42, 0xd8, 0x04, 0x31, 0x4d, 0x9b, 0xc7, 0x32, 0x2b, 0xc8, 0xf1, 0x93, 0x4e, 0x47, 0x63,
+  0x4d, 0xaa, 0x5e, 0xb0, 0x09, 0xb7, 0x1f, 0xd9, 0x34, 0xf4, 0xc8, 0x19, 0x0c, 0xad, 0x45, 0x2c,
+  0x33, 0x63, 0xcb, 0x87, 0x02, 0xec, 0x89, 0xed, 0xd1, 0x84, 0xb8, 0x62, 0x69, 0xb1, 0xad, 0xda,
+  0x05, 0x02, 0x3c, 0x24, 0x81, 0xd9, 0xe3, 0xf6, 0xba, 0x5b, 0x9b, 0x55, 0xed, 0x8f, 0x20, 0xc2,
+  0xa0, 0xd9, 0x39, 0x6b, 0xde, 0xae, 0x55, 0xfb, 0x5e, 0xb7, 0x6f, 0x36, 0xb3, 0x92, 0x82, 0x53,
+  0x1c, 0x4c, 0x6b, 0x7c, 0xbe, 0xd3, 0x75, 0xfa, 0x0d, 0x5e, 0x7f, 0xa3, 0xd7, 0x33, 0xac, 0x20,
+  0x18, 0x51, 0x89, 0x51, 0x6b, 0x4c, 0x93, 0x66, 0xb8, 0xdd, 0x10, 0x95, 0x38, 0x4d, 0x51, 0xc9,
+  0xa6, 0x1a, 0x95, 0x28, 0x14, 0x54, 0xd1, 0xb3, 0x6c, 0xda, 0x70, 0xa3, 0x6e, 0xb0, 0xb4, 0xfd,
+  0x8b, 0x9a, 0x4d, 0x99, 0x04, 0xac, 0xab, 0x7e, 0x61, 0x91, 0x29, 0x0d, 0x6a, 0xc3, 0xfc, 0x6b,
+  0x75, 0x72, 0x6a, 0x52, 0x50, 0x24, 0xaa, 0xb8, 0xe3, 0xe1, 0x14, 0x04, 0x12, 0xde, 0xac, 0x25,
+  0x71, 0xb6, 0x2e, 0x60, 0x49, 0x4a, 0xc4, 0x65, 0x2a, 0x90, 0x17, 0x1e, 0x9a, 0x65, 0x28, 0x66,
+  0x37, 0xbd, 0x83, 0xc2, 0x28, 0x24, 0xf5, 0x0e, 0xbc, 0xaf, 0x0a, 0xca, 0xac, 0x61, 0x2a, 0xfc,
+  0xdf, 0xba, 0x00, 0xaf, 0x92, 0x11, 0x2d, 0x0d, 0xff, 0x5b, 0x0f, 0x4c, 0x40, 0xa8, 0xb7, 0x17,
+  0x90, 0x70, 0xc7, 0xab, 0x55, 0xd3, 0x6a, 0x43, 0xa1, 0x54, 0x70, 0x77, 0x79, 0x2d, 0xdd, 0xee,
+  0xa9, 0xa1, 0x89, 0x36, 0x2c, 0xe9, 0x77, 0x4a, 0x7d, 0x6a, 0xf2, 0x65, 0x46, 0x38, 0x93, 0x52,
+  0x6a, 0x66, 0x9f, 0x28, 0xae, 0xe9, 0x99, 0x28, 0xf6, 0x5d, 0xde, 0x83, 0x76, 0xfc, 0x72, 0x01,
+  0xfe, 0x5a, 0x6d, 0x80, 0x2f, 0x2b, 0xa7, 0xfd, 0xc1, 0xa2, 0x68, 0xca, 0xff, 0xc1, 0x76, 0xcd,
+  0xab, 0x63, 0x97, 0x41, 0x67, 0xb9, 0xe5, 0x9d, 0xd2, 0xf2, 0xca, 0x4c, 0xb9, 0x4d, 0xbc, 0xce,
+  0xc4, 0xa1, 0x54, 0x8f, 0xbd, 0x40, 0xfa, 0xa0, 0x92, 0x26, 0x6d, 0xf3, 0xa5, 0x49, 0x9b, 0xdb,
+  0xf6, 0x8a, 0xb9, 0xbf, 0x32, 0x69, 0xb2, 0xcc, 0x7b, 0x69, 0xd2, 0xe4, 0xf8, 0x22, 0x69, 0xa5,
+  0xca, 0xf1, 0x15, 0x48, 0x13, 0xc5, 0xe3, 0x4b, 0x53, 0x26, 0x86, 0x17, 0x09, 0x2b, 0x56, 0xa3,
+  0x2f, 0x49, 0x97, 0x0b, 0xa6, 0x35, 0x9a, 0x70, 0xcb, 0x9a, 0x44, 0x41, 0x7a, 0x95, 0x8a, 0xc3,
+  0xd5, 0xf2, 0xcb, 0x0b, 0xd5, 0x2b, 0x9a, 0x42, 0xe6, 0x59, 0xc2, 0x9c, 0x01, 0xfb, 0xb9, 0x54,
+  0x6c, 0x5f, 0xeb, 0x80, 0x8a, 0xdc, 0xa2, 0x61, 0x3c, 0xcd, 0x6c, 0xc6, 0x91, 0xf8, 0xfa, 0x82,
+  0xf8, 0xa5, 0x62, 0x37, 0xb1, 0xb2, 0x31, 0xb8, 0x37, 0xfa, 0xf5, 0x6a, 0xe0, 0x69, 0x12, 0x5f,
+  0x6d, 0x92, 0x50, 0x25, 0xc5, 0xa7, 0x24, 0xf0, 0x4c, 0xf1, 0x4b, 0xaf, 0xcb, 0xc7, 0x1b, 0x8b,
+  0x89, 0x97, 0x2b, 0x4b, 0x6d, 0x55, 0x30, 0xb3, 0x7c, 0x19, 0x79, 0xd9, 0x00, 0xbc, 0x36, 0x0e,
+  0x5a, 0x32, 0xd4, 0x59, 0xd4, 0xcb, 0x4d, 0x71, 0x69, 0x81, 0x85, 0x3b, 0x7e, 0x04, 0x3a, 0xa8,
+  0x30, 0x32, 0x9a, 0x66, 0xcc, 0x16, 0xd4, 0xc4, 0x79, 0xa5, 0xfd, 0x98, 0x2a, 0xe7, 0x45, 0x57,
+  0xc6, 0xfe, 0xcd, 0x4f, 0xff, 0xb6, 0xb7, 0x21, 0x60, 0xed, 0xf5, 0x57, 0x50, 0x7f, 0xdd, 0xa9,
+  0x39, 0x02, 0xec, 0x06, 0x11, 0xf6, 0xaa, 0xc6, 0x74, 0x8e, 0x75, 0x1a, 0xf2, 0xc3, 0x92, 0x61,
+  0x10, 0xb9, 0x27, 0x5a, 0x16, 0x54, 0xab, 0xf5, 0x79, 0x18, 0xa2, 0xab, 0xe3, 0x0b, 0x64, 0xac,
+  0xcd, 0x91, 0x51, 0x09, 0x34, 0xba, 0x6b, 0x4d, 0x75, 0xcb, 0xbb, 0xda, 0x76, 0x88, 0xa0, 0x72,
+  0x86, 0xbd, 0x53, 0x39, 0x19, 0x2e, 0x16, 0x4b, 0x62, 0x1a, 0x22, 0x47, 0x88, 0x14, 0xd2, 0x79,
+  0x1b, 0xc4, 0xb0, 0x7c, 0xd5, 0x84, 0x8d, 0x55, 0xbc, 0x7e, 0x54, 0xae, 0x7f, 0x24, 0x11, 0x24,
+  0xc8, 0xa4, 0xbd, 0xb6, 0xc1, 0x82, 0x2a, 0x63, 0xf5, 0x23, 0x9e, 0x06, 0xa9, 0x1a, 0x3f, 0x14,
+  0x68, 0x14, 0xcd, 0xfd, 0xe5, 0xcb, 0x39, 0xba, 0xf9, 0x98, 0x0b, 0x91, 0xf5, 0x99, 0x79, 0xea,
+  0xef, 0xa8, 0x05, 0x9c, 0x41, 0xb9, 0x1d, 0xac, 0x93, 0x81, 0xe4, 0x77, 0x27, 0xc4, 0xa3, 0x18,
+  0xb5, 0x0b, 0x67, 0x45, 0x9b, 0x1b, 0xa0, 0xac, 0x1d, 0x65, 0x55, 0xe3, 0x21, 0x53, 0xf1, 0x70,
+  0xa6, 0xaa, 0x75, 0x8d, 0xbe, 0xa5, 0x40, 0x8a, 0xf1, 0xd0, 0x41, 0x3d, 0x78, 0x68, 0x9c, 0xc4,
+  0x9c, 0x3a, 0xd6, 0xe4, 0x88, 0x90, 0x04, 0xd6, 0xcf, 0x5a, 0xef, 0x6e, 0x97, 0xf5, 0x16, 0x15,
+  0x9f, 0x95, 0x66, 0x09, 0xc9, 0xdc, 0xb1, 0xba, 0x76, 0xf9, 0xd5, 0xee, 0xaa, 0xbc, 0x60, 0xb2,
+  0xbb, 0x2a, 0x2e, 0xc3, 0xec, 0xb2, 0x23, 0x56, 0x79, 0xf7, 0xc4, 0xa3, 0xa7, 0xc8, 0x0d, 0x70,
+  0x9a, 0xee, 0xb5, 0xe6, 0x52, 0x6a, 0x2d, 0xee, 0xa2, 0x14, 0xdb, 0xc5, 0x79, 0x56, 0xa1, 0x91,
+  0x77, 0x18, 0x3b, 0x79, 0x3b, 0x67, 0x7f, 0xcb, 0x70, 0xf3, 0x05, 0xd6, 0x76, 0x94, 0x91, 0x82,
+  0xd3, 0xf3, 0xd1, 0x85, 0x5a, 0x7d, 0x0b, 0x45, 0xa1, 0x1b, 0x50, 0xf7, 0x04, 0x1e, 0xf3, 0x07,
+  0x47, 0xac, 0xb1, 0xdd, 0x51, 0xd6, 0x16, 0x97, 0x67, 0x62, 0x1c, 0x22, 0xea, 0xe5, 0x13, 0x50,
+  0xd8, 0x45, 0x6b, 0xff, 0xcd, 0xab, 0xcf, 0xbe, 0x82, 0x6d, 0x43, 0x53, 0xf3, 0x08, 0xe6, 0x14,
+  0x5a, 0xfb, 0x0f, 0x71, 0x72, 0xa2, 0x1b, 0xb1, 0xbb, 0x2a, 0xc8, 0x2c, 0xb0, 0x64, 0x15, 0x78,
+  0xb2, 0x7f, 0x47, 0xcb, 0xa2, 0x42, 0x79, 0x5a, 0xe5, 0x53, 0xb5, 0x17, 0xc3, 0x92, 0x6e, 0x47,
+  0xd5, 0x9e, 0x4c, 0xda, 0x9a, 0x9e, 0x86, 0xde, 0x3c, 0x58, 0x68, 0xed, 0x8b, 0x73, 0x70, 0x74,
+  0xc8, 0x1f, 0x4a, 0xa2, 0x97, 0x9c, 0x81, 0x57, 0xf2, 0x5a, 0x9c, 0x47, 0xe2, 0x89, 0x61, 0xf1,
+  0x05, 0x3b, 0xe5, 0x78, 0xe9, 0x37, 0x5a, 0xfb, 0x92, 0x95, 0xec, 0xbe, 0x53, 0xc8, 0x10, 0x1d,
+  0x8e, 0xba, 0xdd, 0xae, 0x7e, 0x79, 0x3d, 0x65, 0xa6, 0xc7, 0xd7, 0xc4, 0x9c, 0x67, 0x32, 0xf7,
+  0x66, 0x4e, 0xee, 0x49, 0xe4, 0x91, 0xcb, 0xf0, 0x67, 0xff, 0x88, 0x4e, 0x58, 0x7a, 0x70, 0x1f,
+  0xbc, 0x86, 0x87, 0xda, 0xef, 0x13, 0xf0, 0x8d, 0xe8, 0x09, 0x3c, 0x73, 0x4f, 0x58, 0x22, 0xf1,
+  0xdf, 0xd9, 0xd8, 0x43, 0x7e, 0x49, 0x0d, 0x3d, 0x7a, 0x78, 0x69, 0x89, 0xcb, 0x6b, 0x6e, 0x5a,
+  0x6c, 0x2e, 0x27, 0xf4, 0xc7, 0xe2, 0xc1, 0xdb, 0x25, 0xf1, 0x1c, 0x89, 0x51, 0x78, 0x69, 0xce,
+  0xb8, 0xf3, 0x29, 0xec, 0x8b, 0xa9, 0x05, 0x77, 0xc5, 0xad, 0xfd, 0xd7, 0xbf, 0x7b, 0x99, 0xb3,
+  0xe8, 0x29, 0x8f, 0xa0, 0xae, 0xc8, 0x1e, 0xe5, 0x51, 0xad, 0x61, 0x12, 0x74, 0x57, 0x8c, 0x77,
+  0x5f, 0xe9, 0x60, 0x4b, 0x23, 0xfe, 0xfa, 0x0f, 0x7f, 0x41, 0x80, 0x6b, 0xea, 0xe6, 0x37, 0x16,
+  0xc1, 0x82, 0x8c, 0xfb, 0x66, 0x93, 0x56, 0xf0, 0x9a, 0x3a, 0x93, 0x56, 0x36, 0xf5, 0xac, 0x00,
+  0x5a, 0xa8, 0x26, 0x14, 0xac, 0x7d, 0x4a, 0x42, 0xef, 0x41, 0x34, 0x99, 0xe0, 0xd0, 0x6b, 0x5b,
+  0x60, 0x97, 0xe1, 0xad, 0xd5, 0x31, 0x70, 0xf9, 0xf5, 0xdf, 0x3e, 0xfd, 0xf7, 0x3f, 0x5f, 0xa2,
+  0x03, 0xde, 0x4b, 0xc3, 0x2e, 0xd5, 0x6e, 0x37, 0x10, 0x23, 0x93, 0x7d, 0x13, 0x31, 0xe0, 0x67,
+  0x13, 0xec, 0x66, 0x35, 0xd4, 0xfc, 0x92, 0x51, 0xf3, 0xbe, 0xe8, 0x76, 0x75, 0x72, 0x44, 0x8a,
+  0x6f, 0xa2, 0x06, 0x82, 0x89, 0xd8, 0x4c, 0xca, 0xcb, 0x7f, 0x71, 0xc6, 0x4c, 0x48, 0x32, 0x22,
+  0xa1, 0x7b, 0x0e, 0x2e, 0x20, 0x8a, 0xaf, 0x4e, 0x91, 0x4c, 0x36, 0x4c, 0x24, 0x65, 0xd8, 0x4c,
+  0xd1, 0x9b, 0x57, 0x9f, 0x7f, 0x8a, 0x1e, 0x93, 0x11, 0x06, 0x62, 0x20, 0x1c, 0x58, 0x92, 0x96,
+  0x1b, 0x84, 0xf7, 0x9b, 0x57, 0xbf, 0xf9, 0x7b, 0x21, 0x44, 0x79, 0x0a, 0x01, 0x0a, 0x0f, 0xb3,
+  0x6f, 0x02, 0xe5, 0x0d, 0x7c, 0x4b, 0x48, 0x4a, 0xb2, 0xe3, 0x2c, 0x3a, 0x9e, 0x50, 0xcf, 0x0b,
+  0x48, 0x0d, 0x0f, 0x5f, 0xfe, 0x19, 0xe0, 0x05, 0x9d, 0x59, 0x7e, 0xf1, 0x84, 0x77, 0xbe, 0xba,
+  0x50, 0x1b, 0x54, 0x10, 0x84, 0x7a, 0xcc, 0x82, 0x19, 0xa7, 0x86, 0xac, 0x2f, 0xbe, 0x61, 0x32,
+  0x15, 0x8c, 0x74, 0x6e, 0x8d, 0xa2, 0x7e, 0x0d, 0x45, 0xbf, 0xfd, 0xc7, 0x82, 0xa2, 0xfe, 0x4d,
+  0x59, 0x06, 0x70, 0xfe, 0x44, 0xb5, 0x55, 0xc7, 0x90, 0xef, 0x1d, 0x67, 0xd0, 0x60, 0x41, 0x86,
+  0xdd, 0xeb, 0xf5, 0xcc, 0x1a, 0xfa, 0xcd, 0xc2, 0x74, 0x41, 0x4e, 0x77, 0x3b, 0x34, 0x4a, 0x13,
+  0x76, 0x41, 0x22, 0xa5, 0x45, 0xbb, 0x16, 0x2a, 0xf5, 0xaa, 0xd0, 0xc4, 0x49, 0x67, 0x60, 0x26,
+  0x92, 0x2b, 0xf2, 0x51, 0xae, 0x0f, 0xa8, 0x0d, 0x69, 0x62, 0xda, 0x79, 0x1b, 0xec, 0xcb, 0x97,
+  0x7f, 0x45, 0x0f, 0x78, 0xce, 0x87, 0x44, 0x94, 0xb8, 0xa4, 0x1f, 0x55, 0xf2, 0xc4, 0x86, 0xf4,
+  0xa0, 0x50, 0x96, 0x34, 0xc5, 0x43, 0xa2, 0x72, 0x58, 0xea, 0x9f, 0x47, 0x8a, 0x53, 0x61, 0xf3,
+  0x20, 0x7f, 0x4f, 0x21, 0x58, 0xe5, 0x4f, 0x0d, 0x93, 0xf0, 0x71, 0x28, 0x3b, 0x8f, 0xc9, 0x5e,
+  0x2b, 0x9c, 0x4e, 0x86, 0xcc, 0x31, 0xf1, 0x50, 0x51, 0x4e, 0xd1, 0x2a, 0x2f, 0xc0, 0xeb, 0x5b,
+  0x2d, 0xc4, 0x23, 0xa7, 0xbd, 0x96, 0x03, 0x18, 0x6b, 0xb1, 0x43, 0x53, 0xfe, 0xb2, 0xc5, 0x6e,
+  0x96, 0xee, 0xb5, 0x06, 0xec, 0xe1, 0xf2, 0x31, 0xe0, 0xb2, 0xa6, 0x42, 0xb0, 0x4f, 0xe8, 0x55,
+  0xbb, 0x21, 0x70, 0x90, 0xe2, 0xb9, 0xb9, 0xf8, 0x41, 0x10, 0x23, 0xf5, 0xa7, 0xdd, 0x10, 0x38,
+  0x48, 0x6a, 0x2e, 0x16, 0x3f, 0xdc, 0x68, 0x00, 0xf8, 0x15, 0x23, 0xeb, 0x59, 0x34, 0x23, 0x09,
+  0xfa, 0x2e, 0xd8, 0xd2, 0x80, 0x0e, 0x85, 0xb0, 0x6f, 0xdf, 0x45, 0xc6, 0x8c, 0x88, 0x63, 0xa7,
+  0x7f, 0x5a, 0x63, 0xf3, 0xbf, 0xfc, 0x15, 0x72, 0xfa, 0x3f, 0x96, 0xf4, 0xb2, 0x8c, 0xee, 0xc6,
+  0x23, 0x42, 0x41, 0xd5, 0x34, 0x1d, 0xd6, 0x51, 0xf5, 0x19, 0x7a, 0x7e, 0x78, 0xff, 0x5a, 0xa9,
+  0x6a, 0xf0, 0x8f, 0x2e, 0x8e, 0xb3, 0x69, 0x42, 0x9a, 0xa3, 0x89, 0x2f, 0x7e, 0x0d, 0x42, 0xe5,
+  0x7d, 0x73, 0xe3, 0x99, 0xe7, 0xc4, 0x37, 0x1e, 0x2a, 0xc2, 0x4f, 0x08, 0xbd, 0x8e, 0x1b, 0xe2,
+  0x7b, 0x30, 0xed, 0x5f, 0x33, 0x08, 0x3e, 0xe1, 0xbd, 0x6f, 0x2b, 0xce, 0x97, 0xb4, 0x35, 0x85,
+  0xfb, 0x0a, 0x71, 0xb7, 0x14, 0xf6, 0x4b, 0xe2, 0x6a, 0xa3, 0xff, 0x37, 0xaf, 0xbe, 0xfe, 0x3c,
+  0x27, 0xeb, 0x02, 0x81, 0xbf, 0xde, 0x94, 0xa8, 0x56, 0x65, 0x37, 0x75, 0x13, 0x1a, 0x67, 0x8b,
+  0x7e, 0xab, 0xab, 0x88, 0xd7, 0xe6, 0xc0, 0xaa, 0x87, 0x78, 0x04, 0x2f, 0xc2, 0x05, 0x13, 0xfc,
+  0x69, 0x28, 0x6e, 0x6d, 0x95, 0x6a, 0x78, 0xd5, 0xdb, 0x11, 0x69, 0xc6, 0x2e, 0x9a, 0xb0, 0xfb,
+  0x03, 0x62, 0xaa, 0x3d, 0xe4, 0x45, 0xee, 0x94, 0x4d, 0xd5, 0xcd, 0x5f, 0x1c, 0x04, 0x7c, 0xea,
+  0xee, 0x88, 0x64, 0x3f, 0xcc, 0xb2, 0x84, 0xc2, 0x0e, 0x48, 0xdb, 0x5a, 0x7c, 0x50, 0xc9, 0xaa,
+  0x9c, 0xfa, 0xb0, 0x59, 0x43, 0x32, 0xcb, 0x67, 0x2c, 0x2f, 0xb0, 0xb7, 0x87, 0x2c, 0xf6, 0xc9,
+  0x26, 0x0b, 0xfd, 0x00, 0x59, 0x01, 0x3b, 0x98, 0xb0, 0xd0, 0x8e, 0x7c, 0x74, 0xaf, 0x5c, 0xb9,
+  0x35, 0x92, 0x92, 0x9a, 0x48, 0x59, 0x99, 0xaf, 0xab, 0x10, 0x15, 0x44, 0x2e, 0x0e, 0x40, 0x24,
+  0x09, 0x30, 0x8a, 0x0d, 0x7f, 0x94, 0x91, 0x09, 0x04, 0xb4, 0xd5, 0x41, 0x9a, 0xad, 0xb0, 0xb2,
+  0x66, 0x91, 0x31, 0xc0, 0x08, 0x49, 0xc8, 0xfd, 0xf3, 0x47, 0x9e, 0x9c, 0x85, 0x17, 0x3f, 0xf5,
+  0xac, 0x60, 0x45, 0xce, 0xe6, 0xf1, 0xac, 0x97, 0xa5, 0x12, 0x40, 0x7d, 0xd4, 0x5e, 0x70, 0x72,
+  0xce, 0xba, 0x8e, 0xa6, 0x86, 0xcd, 0xd6, 0xef, 0xb2, 0x49, 0x1e, 0x88, 0x3b, 0x2f, 0xb0, 0xa2,
+  0xc5, 0x4a, 0xb1, 0x56, 0xb5, 0x8c, 0xcd, 0x7a, 0xa9, 0x5d, 0x1f, 0x0a, 0xfe, 0x97, 0x6a, 0xd9,
+  0x88, 0x54, 0x4f, 0x31, 0x4c, 0x4b, 0xbd, 0xfe, 0xfd, 0xcf, 0x41, 0x27, 0x97, 0x5c, 0xec, 0x31,
+  0x17, 0xbb, 0xb9, 0x72, 0x5e, 0x84, 0xf8, 0x23, 0xf1, 0x59, 0x4f, 0xfa, 0x11, 0x41, 0x9c, 0x51,
+  0x55, 0x88, 0xb3, 0x13, 0x99, 0x3a, 0x80, 0xa7, 0xf8, 0x94, 0x78, 0x39, 0x18, 0x4b, 0x40, 0x18,
+  0x95, 0x81, 0xd0, 0x41, 0x1f, 0x7f, 0x9c, 0x63, 0xf2, 0xde, 0x95, 0x91, 0xb8, 0x58, 0xf6, 0xad,
+  0x84, 0x55, 0x91, 0x2b, 0xdf, 0x4a, 0x60, 0x49, 0xcb, 0x3e, 0xc7, 0x51, 0x5a, 0x45, 0x56, 0xd1,
+  0x01, 0xb8, 0xe2, 0xb7, 0x1e, 0x62, 0xd2, 0xa1, 0xec, 0x21, 0x72, 0xca, 0x44, 0x91, 0xe1, 0x04,
+  0xa4, 0xa1, 0x13, 0x5a, 0x94, 0xd0, 0x11, 0x0d, 0x71, 0x70, 0x24, 0x84, 0x27, 0xc6, 0x75, 0x69,
+  0x18, 0x92, 0xe4, 0x47, 0x47, 0x4f, 0x1e, 0x2b, 0x72, 0x02, 0x2a, 0x0f, 0xc7, 0xd1, 0x0c, 0xe5,
+  0x47, 0xc2, 0xac, 0xf2, 0x59, 0x0e, 0x63, 0xd4, 0x09, 0x18, 0x13, 0xea, 0x0b, 0xc4, 0x07, 0x67,
+  0xc4, 0x9d, 0xca, 0x43, 0x01, 0x85, 0x53, 0x72, 0x32, 0x8f, 0xa6, 0x78, 0x18, 0x10, 0x0f, 0xe6,
+  0xca, 0x92, 0x29, 0x51, 0x68, 0xf2, 0xd9, 0xa1, 0x57, 0xdb, 0x5a, 0xb5, 0xd0, 0xf7, 0x51, 0xce,
+  0x93, 0x8a, 0x6c, 0xd8, 0xa7, 0x3f, 0xc2, 0x76, 0x42, 0xd2, 0x18, 0x76, 0x0d, 0x00, 0xdb, 0x47,
+  0xf9, 0x6b, 0x2e, 0xb1, 0x76, 0xc7, 0x34, 0x84, 0x69, 0x10, 0xeb, 0xfe, 0x42, 0xeb, 0x5f, 0x19,
+  0x0f, 0xa3, 0x80, 0x74, 0x83, 0x68, 0xd4, 0xb6, 0x72, 0xf9, 0xa5, 0xec, 0x82, 0x1f, 0xe8, 0x1b,
+  0x1b, 0xda, 0xb9, 0xa7, 0x1d, 0x07, 0x5a, 0xca, 0x12, 0xdd, 0x68, 0x9a, 0xb5, 0xa7, 0x31, 0xf4,
+  0x23, 0xe2, 0x60, 0x66, 0x05, 0xb1, 0xec, 0x56, 0xd9, 0x9f, 0xca, 0xfb, 0xfc, 0xda, 0x95, 0x4f,
+  0x88, 0xc7, 0xee, 0x3e, 0x68, 0x3b, 0xeb, 0xc4, 0xf0, 0xfa, 0x8f, 0xbf, 0x40, 0x87, 0x62, 0xb0,
+  0xd5, 0x48, 0x16, 0x98, 0x2e, 0xe3, 0xae, 0x0d, 0x0b, 0x14, 0xa1, 0x74, 0xaf, 0x69, 0x60, 0x41,
+  0xa6, 0x3e, 0x0e, 0xd4, 0xcb, 0x13, 0x73, 0x05, 0xe1, 0x27, 0xd4, 0x3d, 0x0d, 0x17, 0x3f, 0xd1,
+  0x08, 0xcc, 0xc5, 0x0c, 0x09, 0x24, 0x49, 0xa2, 0xa4, 0x59, 0x64, 0xbc, 0x5b, 0xdb, 0x3a, 0x60,
+  0xbf, 0x98, 0xb4, 0xf8, 0xfb, 0x26, 0xde, 0x8b, 0xb9, 0x2f, 0xce, 0xf9, 0x3f, 0x7d, 0x86, 0xf8,
+  0x42, 0xff, 0x43, 0x7c, 0xef, 0x9b, 0xf8, 0xae, 0xbd, 0x6a, 0x50, 0xb2, 0x50, 0xa5, 0x1a, 0x8e,
+  0x54, 0x49, 0x50, 0x07, 0x59, 0x1f, 0xb8, 0x55, 0x83, 0xf5, 0x56, 0x98, 0xa3, 0x15, 0xdd, 0x4d,
+  0x07, 0x92, 0x8d, 0x23, 0x0f, 0xe2, 0xcc, 0x67, 0x4f, 0x0f, 0x8f, 0xac, 0x95, 0x4a, 0xbb, 0x38,
+  0x5f, 0x4f, 0x77, 0xd0, 0x0b, 0x64, 0x49, 0x7f, 0x62, 0x1f, 0x9d, 0xc7, 0xc4, 0x82, 0x21, 0xec,
+  0xa3, 0xce, 0xd4, 0xe5, 0xcc, 0x5c, 0x3d, 0xb3, 0x67, 0xb3, 0x99, 0xcd, 0xae, 0x96, 0xd8, 0xd3,
+  0x24, 0x20, 0xa1, 0x0b, 0x79, 0xa5, 0x67, 0x81, 0x00, 0x2b, 0x33, 0xb2, 0x73, 0x7e, 0x16, 0xd7,
+  0x4a, 0x31, 0xec, 0x31, 0x02, 0xf3, 0x37, 0x77, 0x9a, 0x54, 0xcb, 0x6c, 0x3e, 0x3f, 0x4c, 0xa3,
+  0xf0, 0x5a, 0xcc, 0x27, 0x47, 0x4d, 0xce, 0xb2, 0x9b, 0x32, 0xa2, 0xff, 0xb7, 0x8b, 0xd7, 0x6a,
+  0x17, 0xbf, 0xe5, 0xc6, 0xae, 0x5c, 0x61, 0xd4, 0xda, 0xb5, 0x5c, 0xc3, 0xea, 0x02, 0xe3, 0xbc,
+  0x8f, 0xd5, 0xe9, 0xf2, 0x32, 0x69, 0x99, 0x90, 0x65, 0xaa, 0xe2, 0x73, 0xdb, 0xba, 0x0c, 0xbd,
+  0xf3, 0x22, 0xe4, 0xad, 0x11, 0xac, 0x39, 0x6c, 0x58, 0x92, 0xe2, 0xa2, 0x62, 0x57, 0x08, 0xce,
+  0x4d, 0xad, 0x38, 0x7f, 0xb7, 0x6e, 0x2d, 0xea, 0x33, 0xf2, 0x25, 0x27, 0x44, 0xc9, 0x02, 0xd8,
+  0x6c, 0x7a, 0xe8, 0x89, 0xed, 0x2d, 0x6e, 0x23, 0xc8, 0x8d, 0x32, 0xb7, 0x72, 0x83, 0xba, 0x2d,
+  0x56, 0x91, 0x8b, 0x0b, 0x05, 0x2f, 0x6a, 0xfa, 0x75, 0x6c, 0xd9, 0x5a, 0xec, 0xa9, 0xd6, 0x18,
+  0x18, 0x18, 0xc0, 0xb5, 0xf5, 0x12, 0x0a, 0x29, 0xa6, 0x13, 0xd7, 0x5e, 0x1e, 0x85, 0x7e, 0x64,
+  0x84, 0x0c, 0x8e, 0xe9, 0x2a, 0x85, 0x0e, 0xd6, 0xad, 0xf9, 0x3a, 0xb3, 0x32, 0xe5, 0x57, 0x6c,
+  0xb4, 0xb8, 0xe9, 0x8a, 0xe6, 0x63, 0xea, 0xf1, 0x5a, 0xc0, 0xf3, 0xf0, 0x24, 0x8c, 0x66, 0xa1,
+  0x75, 0x73, 0xe0, 0x90, 0x77, 0x86, 0x18, 0x73, 0xae, 0x08, 0x0d, 0xf3, 0xc6, 0x60, 0x1b, 0xf8,
+  0x14, 0xd3, 0x80, 0x19, 0x67, 0xeb, 0xb2, 0x52, 0xae, 0x80, 0x86, 0xa6, 0xf2, 0x11, 0x31, 0x24,
+  0xc5, 0x02, 0xab, 0x92, 0xc6, 0x3a, 0xfb, 0x56, 0xb9, 0xdb, 0xa3, 0x16, 0x3c, 0x58, 0xbd, 0xa2,
+  0x66, 0x39, 0x6e, 0x05, 0x8b, 0x8b, 0xd5, 0x04, 0xa0, 0xe2, 0x3a, 0x10, 0xe2, 0xb7, 0x32, 0xd9,
+  0xad, 0x22, 0x71, 0x41, 0x59, 0xfe, 0x75, 0x23, 0xcd, 0x35, 0xa1, 0x65, 0x4b, 0x17, 0x57, 0x5b,
+  0x5f, 0xfe, 0x4d, 0xa3, 0xf2, 0xfa, 0xbe, 0xaf, 0x23, 0xa0, 0xb1, 0x4c, 0x76, 0xa7, 0x82, 0x14,
+  0xec, 0x79, 0x07, 0x2c, 0xcc, 0x7f, 0x4c, 0x53, 0x40, 0x04, 0x61, 0xa8, 0x7b, 0xfa, 0x44, 0xc2,
+  0x83, 0xdd, 0x17, 0x83, 0x08, 0x76, 0x65, 0x2e, 0xee, 0x8a, 0x0e, 0x17, 0xca, 0x6b, 0x65, 0x52,
+  0xca, 0xce, 0x42, 0xd7, 0x56, 0xb4, 0x0c, 0xd5, 0xd2, 0xc6, 0x73, 0x61, 0x10, 0x05, 0xe7, 0x58,
+  0x22, 0x92, 0x9c, 0xa3, 0x3e, 0x12, 0x1f, 0x95, 0x48, 0x15, 0x17, 0x97, 0xf1, 0x3f, 0x3c, 0x04,
+  0xde, 0x4f, 0x89, 0x3d, 0x95, 0x48, 0x22, 0x87, 0x32, 0xf0, 0x50, 0x16, 0xcb, 0x77, 0x57, 0xc5,
+  0x85, 0xdb, 0xdd, 0x55, 0xf1, 0x47, 0xea, 0x58, 0xeb, 0x7f, 0x00, 0x89, 0xe4, 0x81, 0xd3, 0xb9,
+  0x4e, 0x00, 0x00,
+};
+
+#endif
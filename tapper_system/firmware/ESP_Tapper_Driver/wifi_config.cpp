@@ -1,4 +1,8 @@
 #include "wifi_config.h"
+#include <Preferences.h>
+#include <ESPmDNS.h>
+
+extern uint8_t assignedStationId;  // Station assignment (http_server.cpp)
 
 // Define your SSID and Password here or use a config system
 const char* ssid = "NETWORK_NAME"; // Use the actual network
@@ -6,39 +10,181 @@ const char* password = "PASSWORD"; // Use the actual Network Password
 
 String WiFiConfig::deviceId = "tapper_001";  // Define the static variable
 
+namespace {
+
+const char* WIFI_NAMESPACE = "tapper_wifi";
+
+// Cached network state from the last successful connection
+struct CachedNetwork {
+  bool valid = false;
+  uint8_t bssid[6] = { 0 };
+  int32_t channel = 0;
+  uint32_t ip = 0;
+  uint32_t gateway = 0;
+  uint32_t subnet = 0;
+  uint32_t dns = 0;
+};
+
+CachedNetwork cachedNetwork;
+
+// Fast-path escape hatch: after this many consecutive failed attempts the
+// pinned BSSID/channel/lease is assumed stale (AP replaced, channel moved,
+// subnet reassigned) and we fall back to a full scan + DHCP join
+const uint8_t FAST_PATH_MAX_FAILURES = 5;
+bool usingCachedNetwork = false;
+uint8_t failedAttempts = 0;
+
+void loadCachedNetwork() {
+  Preferences prefs;
+  if (!prefs.begin(WIFI_NAMESPACE, true)) {
+    return;  // First boot - nothing cached yet
+  }
+  if (prefs.getBytesLength("bssid") == sizeof(cachedNetwork.bssid)) {
+    prefs.getBytes("bssid", cachedNetwork.bssid, sizeof(cachedNetwork.bssid));
+    cachedNetwork.channel = prefs.getInt("channel", 0);
+    cachedNetwork.ip = prefs.getUInt("ip", 0);
+    cachedNetwork.gateway = prefs.getUInt("gateway", 0);
+    cachedNetwork.subnet = prefs.getUInt("subnet", 0);
+    cachedNetwork.dns = prefs.getUInt("dns", 0);
+    cachedNetwork.valid = (cachedNetwork.channel != 0);
+  }
+  prefs.end();
+}
+
+void saveCachedNetwork() {
+  Preferences prefs;
+  prefs.begin(WIFI_NAMESPACE, false);
+  prefs.putBytes("bssid", WiFi.BSSID(), 6);
+  prefs.putInt("channel", WiFi.channel());
+  prefs.putUInt("ip", (uint32_t)WiFi.localIP());
+  prefs.putUInt("gateway", (uint32_t)WiFi.gatewayIP());
+  prefs.putUInt("subnet", (uint32_t)WiFi.subnetMask());
+  prefs.putUInt("dns", (uint32_t)WiFi.dnsIP());
+  prefs.end();
+}
+
+void clearCachedNetwork() {
+  Preferences prefs;
+  if (prefs.begin(WIFI_NAMESPACE, false)) {
+    prefs.clear();
+    prefs.end();
+  }
+  cachedNetwork.valid = false;
+}
+
+void onWiFiEvent(WiFiEvent_t event) {
+  switch (event) {
+    case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+      Serial.println("[WiFi] Connected!");
+      Serial.print("[WiFi] IP Address: ");
+      Serial.println(WiFi.localIP());
+      failedAttempts = 0;
+      // Persist BSSID/channel/IP so the next boot can skip scan and DHCP
+      saveCachedNetwork();
+      // SNTP for group-command scheduling - runs in the background and the
+      // schedulers check isTimeSynced() before trusting the clock
+      configTime(0, 0, "pool.ntp.org", "time.nist.gov");
+      // Push-based discovery - announce before anyone has to scan for us
+      WiFiConfig::announceMdns();
+      break;
+
+    case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+      // Keep retrying in the background; no one blocks on this. If the
+      // pinned parameters keep failing, stop trusting them - otherwise a
+      // swapped AP or reassigned lease leaves the device offline forever
+      if (usingCachedNetwork && ++failedAttempts >= FAST_PATH_MAX_FAILURES) {
+        Serial.println("[WiFi] Cached fast path keeps failing - falling back to scan + DHCP");
+        usingCachedNetwork = false;
+        failedAttempts = 0;
+        clearCachedNetwork();
+        WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);  // Back to DHCP
+        WiFi.begin(ssid, password);
+      } else {
+        WiFi.reconnect();
+      }
+      break;
+
+    default:
+      break;
+  }
+}
+
+}  // namespace
+
 namespace WiFiConfig {
 
 void connect() {
-  Serial.println("[WiFi] Connecting to WiFi...");
-  WiFi.begin(ssid, password);
-  int retryCount = 0;
-  while (WiFi.status() != WL_CONNECTED && retryCount < 20) {
-    delay(500);
-    Serial.print(".");
-    retryCount++;
-  }
-  Serial.println();
+  Serial.println("[WiFi] Starting async WiFi connection...");
 
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.println("[WiFi] Connected!");
-    Serial.print("[WiFi] IP Address: ");
-    Serial.println(WiFi.localIP());
+  // Device ID comes from the MAC, which is readable before association -
+  // MQTT topics and HTTP info are correct from the first loop pass
+  String mac = WiFi.macAddress();
+  String suffix = mac.substring(mac.length() - 6);  // Last 6 chars
+  suffix.replace(":", "");                          // Remove colons
+  deviceId = "tapper_" + suffix;
+  Serial.println("[WiFi] Device ID: " + deviceId);
 
-    // Assign deviceId (e.g., tapper_5EBC2C)
-    String mac = WiFi.macAddress();
-    String suffix = mac.substring(mac.length() - 6);  // Last 6 chars
-    suffix.replace(":", "");                          // Remove colons
-    deviceId = "tapper_" + suffix;
-    Serial.println("[WiFi] Device ID: " + deviceId);
+  WiFi.mode(WIFI_STA);
+  WiFi.onEvent(onWiFiEvent);
+  WiFi.setAutoReconnect(true);
 
+  loadCachedNetwork();
+  if (cachedNetwork.valid) {
+    // Fast path: static-configure the cached lease and join the last BSSID
+    // on its known channel - no scan, no DHCP round trip
+    Serial.println("[WiFi] Using cached BSSID/channel/IP for fast reconnect");
+    WiFi.config(IPAddress(cachedNetwork.ip), IPAddress(cachedNetwork.gateway),
+                IPAddress(cachedNetwork.subnet), IPAddress(cachedNetwork.dns));
+    WiFi.begin(ssid, password, cachedNetwork.channel, cachedNetwork.bssid);
+    usingCachedNetwork = true;
   } else {
-    Serial.println("[WiFi] Failed to connect.");
-    deviceId = "tapper_unknown";
+    WiFi.begin(ssid, password);
   }
+
+  // No waiting here - motor, HTTP, and MQTT init proceed immediately and
+  // the connection comes up in the background
+}
+
+bool isConnected() {
+  return WiFi.status() == WL_CONNECTED;
 }
 
 String getDeviceID() {
   return deviceId;
 }
 
-}
\ No newline at end of file
+bool isTimeSynced() {
+  // SNTP has clearly landed once the clock is past a recent fixed epoch
+  return time(nullptr) > 1700000000;  // 2023-11-14
+}
+
+uint64_t epochMillis() {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  return (uint64_t)tv.tv_sec * 1000ULL + tv.tv_usec / 1000;
+}
+
+void announceMdns() {
+  static bool mdnsStarted = false;
+  if (!isConnected()) {
+    return;
+  }
+
+  if (!mdnsStarted) {
+    if (!MDNS.begin(deviceId.c_str())) {
+      Serial.println("[mDNS] Failed to start responder");
+      return;
+    }
+    MDNS.addService("tapper", "tcp", 80);
+    mdnsStarted = true;
+  }
+
+  // TXT records are replaced in place, so re-announcing after a station
+  // assignment change just updates the existing service entry
+  MDNS.addServiceTxt("tapper", "tcp", "device_id", deviceId.c_str());
+  MDNS.addServiceTxt("tapper", "tcp", "station_id", String(assignedStationId).c_str());
+  Serial.println("[mDNS] Announced " + deviceId + ".local (_tapper._tcp, station " +
+                 String(assignedStationId) + ")");
+}
+
+}
@@ -7,9 +7,28 @@
 namespace WiFiConfig {
   extern String deviceId;
 
+  // NEW: Non-blocking connect. Kicks off the WiFi join (direct-channel
+  // BSSID join plus cached static IP when NVS has a previous session) and
+  // returns immediately so motor/HTTP/MQTT init are not gated on DHCP.
+  // Association completes in the background via WiFi events, which also
+  // persist the BSSID/channel/IP for the next boot.
   void connect();
   void setup();
+  bool isConnected();
   String getDeviceID();
+
+  // NEW: SNTP-backed wall clock for fleet-synchronized execution. SNTP is
+  // kicked off when the interface gets an IP; until isTimeSynced() reports
+  // true, scheduled commands fall back to immediate execution.
+  bool isTimeSynced();
+  uint64_t epochMillis();
+
+  // NEW: DNS-SD announce (_tapper._tcp on port 80) carrying the device ID
+  // and station assignment as TXT records, so fleet tooling discovers
+  // tappers by listening instead of HTTP-scanning the subnet. Called when
+  // the interface comes up and again whenever the station assignment
+  // changes.
+  void announceMdns();
 }
 
-#endif
\ No newline at end of file
+#endif